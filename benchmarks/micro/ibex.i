@@ -0,0 +1,50 @@
+# Base input for the Ibex object micro-benchmarks, the object being timed is added from the
+# command line by python/tools/runBenchmarks.py (e.g., Kernels/bench/type=IbexShortwaveForcingFunction).
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 64
+  ny = 64
+  xmax = 0.35
+  ymax = 0.4
+[]
+
+[Variables]
+  [./T]
+    initial_condition = 264.15
+  [../]
+[]
+
+[Functions]
+  [./shortwave]
+    type = ParsedFunction
+    value = SW*sin(w*2*pi*x)
+    vals = '650 0.7'
+    vars = 'SW w'
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T
+    snow_density = 174
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = PikaBenchmark
+  dt = 1
+  residual_evaluations = 20
+  jacobian_evaluations = 10
+[]
+
+[Outputs]
+  console = true
+[]
@@ -0,0 +1,91 @@
+# Micro-benchmark of PikaMaterial: the materials are evaluated by a MaterialRealAux, without any
+# Kernel, so the timing excludes the assembly (see python/tools/runBenchmarks.py).
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 64
+  ny = 64
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[Variables]
+  [./T]
+  [../]
+  [./u]
+  [../]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.0003-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*1e-5))'
+  [../]
+  [./T_func]
+    type = ParsedFunction
+    value = 500*y+265
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+  [./temperature_ic]
+    variable = T
+    type = FunctionIC
+    function = T_func
+  [../]
+  [./vapor_ic]
+    variable = u
+    type = PikaChemicalPotentialIC
+    phase_variable = phi
+    temperature = T
+  [../]
+[]
+
+[AuxVariables]
+  [./tau]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[AuxKernels]
+  [./tau]
+    type = MaterialRealAux
+    variable = tau
+    property = relaxation_time
+    execute_on = timestep_end
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = T
+  interface_thickness = 1e-5
+  temporal_scaling = 1e-4
+  phase = phi
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = PikaBenchmark
+  dt = 1
+  property_evaluations = 0
+  residual_evaluations = 0
+  jacobian_evaluations = 0
+  aux_evaluations = 20
+[]
+
+[Outputs]
+  console = true
+[]
@@ -0,0 +1,73 @@
+# Base input for the Pika object micro-benchmarks, the object being timed is added from the
+# command line by python/tools/runBenchmarks.py (e.g., Kernels/bench/type=PhaseTransition).
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 64
+  ny = 64
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[Variables]
+  [./T]
+  [../]
+  [./u]
+  [../]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.0003-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*1e-5))'
+  [../]
+  [./T_func]
+    type = ParsedFunction
+    value = 500*y+265
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+  [./temperature_ic]
+    variable = T
+    type = FunctionIC
+    function = T_func
+  [../]
+  [./vapor_ic]
+    variable = u
+    type = PikaChemicalPotentialIC
+    phase_variable = phi
+    temperature = T
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = T
+  interface_thickness = 1e-5
+  temporal_scaling = 1e-4
+  phase = phi
+[]
+
+[Problem]
+  type = FEProblem
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = PikaBenchmark
+  dt = 1
+  property_evaluations = 0
+  residual_evaluations = 20
+  jacobian_evaluations = 10
+[]
+
+[Outputs]
+  console = true
+[]
@@ -0,0 +1,159 @@
+# Scaled, self-contained version of the snow_3d problem; the micro-CT image stack used by
+# problems/snow_3d/phi_initial.i is not distributed, so the ice is represented by four spheres.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 12
+  ny = 12
+  nz = 12
+  xmax = 0.001
+  ymax = 0.001
+  zmax = 0.001
+[]
+
+[Variables]
+  [./T]
+  [../]
+  [./u]
+  [../]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./T_func]
+    type = ParsedFunction
+    value = 500*z+265
+  [../]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'max(max(tanh((0.0003-sqrt((x-0.0003)^2+(y-0.0003)^2+(z-0.0003)^2))/(sqrt(2)*5e-5)),
+                     tanh((0.0003-sqrt((x-0.0007)^2+(y-0.0007)^2+(z-0.0003)^2))/(sqrt(2)*5e-5))),
+                 max(tanh((0.0003-sqrt((x-0.0003)^2+(y-0.0007)^2+(z-0.0007)^2))/(sqrt(2)*5e-5)),
+                     tanh((0.0003-sqrt((x-0.0007)^2+(y-0.0003)^2+(z-0.0007)^2))/(sqrt(2)*5e-5))))'
+  [../]
+[]
+
+[Kernels]
+  [./heat_diffusion]
+    type = PikaDiffusion
+    variable = T
+    use_temporal_scaling = true
+    property = conductivity
+  [../]
+  [./heat_time]
+    type = PikaTimeDerivative
+    variable = T
+    property = heat_capacity
+    scale = 1.0
+  [../]
+  [./heat_phi_time]
+    type = PikaCoupledTimeDerivative
+    variable = T
+    property = latent_heat
+    scale = -0.5
+    use_temporal_scaling = true
+    coupled_variable = phi
+  [../]
+  [./vapor_time]
+    type = PikaTimeDerivative
+    variable = u
+    coefficient = 1.0
+    scale = 1.0
+  [../]
+  [./vapor_diffusion]
+    type = PikaDiffusion
+    variable = u
+    use_temporal_scaling = true
+    property = diffusion_coefficient
+  [../]
+  [./vapor_phi_time]
+    type = PikaCoupledTimeDerivative
+    variable = u
+    coefficient = 0.5
+    coupled_variable = phi
+    use_temporal_scaling = true
+  [../]
+  [./phi_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+    scale = 1.0
+  [../]
+  [./phi_transition]
+    type = PhaseTransition
+    variable = phi
+    mob_name = mobility
+    chemical_potential = u
+    coefficient = 1.0
+    lambda = phase_field_coupling_constant
+  [../]
+  [./phi_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+  [./phi_square_gradient]
+    type = ACInterface
+    variable = phi
+    mob_name = mobility
+    kappa_name = interface_thickness_squared
+  [../]
+[]
+
+[BCs]
+  [./T_hot]
+    type = DirichletBC
+    variable = T
+    boundary = front
+    value = 265.5
+  [../]
+  [./T_cold]
+    type = DirichletBC
+    variable = T
+    boundary = back
+    value = 265
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+  [./temperature_ic]
+    variable = T
+    type = FunctionIC
+    function = T_func
+  [../]
+  [./vapor_ic]
+    variable = u
+    type = PikaChemicalPotentialIC
+    phase_variable = phi
+    temperature = T
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = T
+  interface_thickness = 5e-5
+  temporal_scaling = 1e-4
+  condensation_coefficient = .01
+  phase = phi
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  num_steps = 3
+  dt = 1
+  nl_abs_tol = 1e-12
+  nl_rel_tol = 1e-07
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -33,6 +33,8 @@ InputParameters validParams<PikaMaterialAction>();
  *   (4) PhaseFieldProperties - contains properties related to the the phase field equation
  *   (5) ConstantProperties - converts constants defined in the PropertyUserObject into
  *                          material proprieties for access inside of Kernels.
+ *   (6) PikaVariableScaling - sets the residual scaling of the variables, only created when
+ *                             'automatic_scaling = true'
  *
  * Note: This action does not create the aforementioned objects themselves, it creates the
  * actions that will then build the objects.
@@ -67,6 +69,11 @@ private:
    * @param object_name The longname of the object
    */
   void create(std::string action_name, std::string type, std::string object_name);
+
+  /**
+   * Builds the PikaVariableScaling user object action
+   */
+  void createVariableScaling();
 };
 
 #endif //PIKAMATERIALACTION_H
@@ -0,0 +1,64 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+
+#ifndef PIKAPHASEBOUNDSACTION_H
+#define PIKAPHASEBOUNDSACTION_H
+
+// MOOSE includes
+#include "Action.h"
+
+// Forward declerations
+class PikaPhaseBoundsAction;
+
+template<>
+InputParameters validParams<PikaPhaseBoundsAction>();
+
+/**
+ * Constrains the phase-field variable to [lower, upper] within the nonlinear solve.
+ *
+ * The bounds are imposed with PETSc's variational-inequality solver, so the phase cannot
+ * overshoot and the timestep is not cut to recover from an overshoot. The solver must be
+ * selected in the Executioner block:
+ *
+ *   petsc_options_iname = '-snes_type'
+ *   petsc_options_value = 'vinewtonrsls'
+ *
+ * This action creates the following objects:
+ *   (1) AuxVariables '_pika_phase_lower_bound' and '_pika_phase_upper_bound'
+ *   (2) AuxKernels (BoundsAux) '_pika_phase_lower_bound' and '_pika_phase_upper_bound'
+ */
+class PikaPhaseBoundsAction : public Action
+{
+public:
+
+  /**
+   * Class constructor
+   * @param params Input parameters associated with this actions
+   */
+  PikaPhaseBoundsAction(InputParameters params);
+
+  /**
+   * Creates the bound variables and the actions for the BoundsAux objects
+   */
+  virtual void act();
+
+private:
+
+  /**
+   * Creates the bound variable and the action for its BoundsAux object
+   * @param type The type of bound ('lower' or 'upper')
+   * @param value The value of the bound
+   */
+  void createBound(const std::string & type, Real value);
+};
+
+#endif //PIKAPHASEBOUNDSACTION_H
@@ -0,0 +1,90 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAPRECONDITIONINGACTION_H
+#define PIKAPRECONDITIONINGACTION_H
+
+// MOOSE includes
+#include "Action.h"
+
+// Forward declerations
+class PikaPreconditioningAction;
+class MooseObjectAction;
+
+template<>
+InputParameters validParams<PikaPreconditioningAction>();
+
+/**
+ * Sets up a physics-based field-split preconditioner for the coupled T/u/phi system.
+ *
+ * The system is split into a diffusion block (temperature and chemical potential) and
+ * a phase-field block. Each diffusion variable is preconditioned with AMG, the phase-field
+ * block with a cheap smoother, and the two blocks are coupled multiplicatively or
+ * with a Schur complement.
+ *
+ * This action creates the following objects:
+ *   (1) FSP - the field-split preconditioner, with '_pika_top' as the top split
+ *   (2) Split '_pika_top' - couples '_pika_diffusion' and '_pika_phase'
+ *   (3) Split '_pika_diffusion' - additive split over the temperature and vapor splits, only
+ *       created when both are given (otherwise the single split is part of '_pika_top')
+ *   (4) Split '_pika_temperature', '_pika_vapor', '_pika_phase' - single variable splits
+ *
+ * Note: As with PikaMaterialAction, this creates the actions that build the objects.
+ */
+class PikaPreconditioningAction : public Action
+{
+public:
+
+  /**
+   * Class constructor
+   * @param params Input parameters associated with this actions
+   */
+  PikaPreconditioningAction(InputParameters params);
+
+  /**
+   * Creates the preconditioner and split actions
+   */
+  virtual void act();
+
+private:
+
+  /**
+   * Creates the FSP preconditioner action
+   */
+  void createPreconditioner();
+
+  /**
+   * Creates an action for a Split that divides the system into sub-splits
+   * @param name The name of the split
+   * @param splitting The names of the sub-splits
+   * @param splitting_type The type of coupling between the sub-splits
+   */
+  void createSplit(const std::string & name, const std::vector<std::string> & splitting, const std::string & splitting_type);
+
+  /**
+   * Creates an action for a Split containing a single variable
+   * @param name The name of the split
+   * @param var The name of the variable
+   * @param iname PETSc option names applied to the split
+   * @param value PETSc option values applied to the split
+   */
+  void createVariableSplit(const std::string & name, const NonlinearVariableName & var,
+                           const std::vector<std::string> & iname, const std::vector<std::string> & value);
+
+  /**
+   * Helper for building the split action and adding it to the warehouse
+   * @param name The name of the split
+   * @return The object parameters of the Split
+   */
+  InputParameters & addSplitAction(const std::string & name);
+};
+
+#endif //PIKAPRECONDITIONINGACTION_H
@@ -13,6 +13,7 @@
 
 //Pika includes
 #include "PropertyUserObjectInterface.h"
+#include "PikaTimerInterface.h"
 class PikaCriteria;
 
 template<>
@@ -30,10 +31,19 @@ InputParameters validParams<PikaCriteria>();
  *
  */
 class PikaCriteria : public AuxKernel,
-                     public PropertyUserObjectInterface
+                     public PropertyUserObjectInterface,
+                     public PikaTimerInterface
 {
 public:
   PikaCriteria(const InputParameters & parameters);
+
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void compute();
+  ///@}
+
   virtual ~PikaCriteria(){}
 
 protected:
@@ -83,4 +93,9 @@ private:
 
   /// Temporal scaling factor
   Real _xi;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _compute_timer;
+  ///@}
 };
@@ -15,6 +15,7 @@
 // MOOSE includes
 #include "AuxKernel.h"
 #include "PropertyUserObjectInterface.h"
+#include "PikaTimerInterface.h"
 
 // Forward declarations
 class PikaInterfaceVelocity;
@@ -27,7 +28,8 @@ InputParameters validParams<PikaInterfaceVelocity>();
  */
 class PikaInterfaceVelocity :
   public AuxKernel,
-  public PropertyUserObjectInterface
+  public PropertyUserObjectInterface,
+  public PikaTimerInterface
 {
 public:
 
@@ -38,6 +40,13 @@ public:
    */
   PikaInterfaceVelocity(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void compute();
+  ///@}
+
   /**
    * Class destructor
    */
@@ -60,6 +69,11 @@ private:
 
   /// Gradient of the chemical potential variable
   const VariableGradient & _grad_s;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _compute_timer;
+  ///@}
 };
 
 #endif //PIKAINTERFACEVELOCITY_H
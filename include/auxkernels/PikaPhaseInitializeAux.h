@@ -15,6 +15,9 @@
 // MOOSE includes
 #include "AuxKernel.h"
 
+// Pika includes
+#include "PikaTimerInterface.h"
+
 // Forward declarations
 class PikaPhaseInitializeAux;
 
@@ -24,7 +27,9 @@ InputParameters validParams<PikaPhaseInitializeAux>();
 /**
  * An AuxKernel for computing a limited phase variable
  */
-class PikaPhaseInitializeAux : public AuxKernel
+class PikaPhaseInitializeAux :
+  public AuxKernel,
+  public PikaTimerInterface
 {
 public:
 
@@ -35,6 +40,13 @@ public:
    */
   PikaPhaseInitializeAux(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void compute();
+  ///@}
+
 protected:
 
   /**
@@ -53,6 +65,10 @@ private:
   /// The lower range to limit the variable
   Real _lower;
 
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _compute_timer;
+  ///@}
 };
 
 #endif //PIKAPHASEINITIALIZEAUX_H
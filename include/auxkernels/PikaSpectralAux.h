@@ -0,0 +1,71 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKASPECTRALAUX_H
+#define PIKASPECTRALAUX_H
+
+// MOOSE includes
+#include "AuxKernel.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaSpectralAux;
+class PikaSpectralSolver;
+
+template<>
+InputParameters validParams<PikaSpectralAux>();
+
+/**
+ * Samples a field computed by the PikaSpectralSolver
+ */
+class PikaSpectralAux :
+  public AuxKernel,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters InputParameters for the object
+   */
+  PikaSpectralAux(const InputParameters & parameters);
+
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void compute();
+  ///@}
+
+protected:
+
+  /**
+   * Interpolates the spectral grid at the current node or quadrature point
+   */
+  virtual Real computeValue();
+
+private:
+
+  /// The spectral solver
+  const PikaSpectralSolver & _solver;
+
+  /// The field to sample
+  const unsigned int _field;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _compute_timer;
+  ///@}
+};
+
+#endif // PIKASPECTRALAUX_H
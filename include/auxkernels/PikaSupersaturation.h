@@ -17,6 +17,7 @@
 
 // Pika includes
 #include "PropertyUserObjectInterface.h"
+#include "PikaTimerInterface.h"
 
 // Forward declarations
 class PikaSupersaturation;
@@ -29,7 +30,8 @@ InputParameters validParams<PikaSupersaturation>();
  */
 class PikaSupersaturation :
   public AuxKernel,
-  public PropertyUserObjectInterface
+  public PropertyUserObjectInterface,
+  public PikaTimerInterface
 {
 public:
 
@@ -40,6 +42,13 @@ public:
    */
   PikaSupersaturation(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void compute();
+  ///@}
+
   /**
    * Class destructor
    */
@@ -68,6 +77,11 @@ private:
 
   /// If true, the supersaturation is normalized as in Eq. 18 by rho_vs
   bool _normalize;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _compute_timer;
+  ///@}
 };
 
 #endif //PIKASUPERSATURATION_H
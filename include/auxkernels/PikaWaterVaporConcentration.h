@@ -17,6 +17,7 @@
 
 // Pika includes
 #include "PropertyUserObjectInterface.h"
+#include "PikaTimerInterface.h"
 
 // Forward declarations
 class PikaWaterVaporConcentration;
@@ -29,7 +30,8 @@ InputParameters validParams<PikaWaterVaporConcentration>();
  */
 class PikaWaterVaporConcentration :
   public AuxKernel,
-  public PropertyUserObjectInterface
+  public PropertyUserObjectInterface,
+  public PikaTimerInterface
 {
 public:
 
@@ -40,6 +42,13 @@ public:
    */
   PikaWaterVaporConcentration(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void compute();
+  ///@}
+
   /**
    * Class destructor
    */
@@ -63,6 +72,10 @@ private:
   /// Reference to the reference temperature stored in PropertyUserObject
   const Real & _T_0;
 
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _compute_timer;
+  ///@}
 };
 
 #endif //PIKAWATERVAPORCONCENTRATION_H
@@ -15,16 +15,26 @@
 // MOOSE includes
 #include "IntegratedBC.h"
 
+// Pika includes
+#include "PikaTimerInterface.h"
+
 // Forward declarations
 class IbexSurfaceFluxBC;
+class IbexMeteorologicalForcing;
 
 template<>
 InputParameters validParams<IbexSurfaceFluxBC>();
 
 /**
+ * Surface energy balance of the snow surface: long-wave, short-wave, latent and sensible heat.
  *
+ * The meteorological inputs are either the constant parameters and the radiation Functions or,
+ * for the channels it provides, an IbexMeteorologicalForcing object. The terms that depend only
+ * on the meteorological inputs are computed once per residual/Jacobian evaluation.
  */
-class IbexSurfaceFluxBC : public IntegratedBC
+class IbexSurfaceFluxBC :
+  public IntegratedBC,
+  public PikaTimerInterface
 {
 public:
 
@@ -35,6 +45,22 @@ public:
    */
   IbexSurfaceFluxBC(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  ///@}
+
+  ///@{
+  /**
+   * Updates the meteorological inputs and the terms that depend only on them
+   */
+  virtual void residualSetup();
+  virtual void jacobianSetup();
+  ///@}
+
 protected:
 
   /**
@@ -57,25 +83,46 @@ private:
 
   Real airDensity();
 
+  /**
+   * Updates the meteorological inputs, see residualSetup
+   */
+  void updateForcing();
+
   const Real _boltzmann;
 
   const Real _gas_constant_air;
 
   const Real _gas_constant_water_vapor;
 
-  const Real _air_temperature;
+  Real _air_temperature;
 
-  const Real _relative_humidity;
+  Real _relative_humidity;
 
-  const Real _atmospheric_pressure;
+  Real _atmospheric_pressure;
 
-  const Real _air_velocity;
+  Real _air_velocity;
 
   const Real _swir_albedo;
 
-  const Function & _long_wave;
+  /// Radiation functions, NULL when given by the forcing
+  const Function * _long_wave;
+
+  const Function * _short_wave;
 
-  const Function & _short_wave;
+  /// Optional meteorological forcing
+  const IbexMeteorologicalForcing * _forcing;
+
+  ///@{
+  /// Radiation from the forcing
+  Real _long_wave_in;
+  Real _short_wave_in;
+  ///@}
+
+  ///@{
+  /// Terms depending only on the meteorological inputs, see updateForcing
+  Real _air_density;
+  Real _air_vapor_pressure;
+  ///@}
 
   const Real _emissivity;
 
@@ -92,6 +139,12 @@ private:
   Real _reference_vapor_pressure;
 
   Real _specific_heat_air;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 #endif //IBEXSURFACEFLUXBC_H
@@ -17,6 +17,7 @@
 
 // PIKA includes
 #include "PropertyUserObjectInterface.h"
+#include "PikaTimerInterface.h"
 
 //Forward Declarations
 class PikaChemicalPotentialBC;
@@ -30,10 +31,20 @@ InputParameters validParams<PikaChemicalPotentialBC>();
  */
 class PikaChemicalPotentialBC :
   public NodalBC,
-  public PropertyUserObjectInterface
+  public PropertyUserObjectInterface,
+  public PikaTimerInterface
 {
 public:
   PikaChemicalPotentialBC(const InputParameters & parameters);
+
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  ///@}
+
   virtual ~PikaChemicalPotentialBC(){};
 
 protected:
@@ -50,6 +61,12 @@ private:
 
   /// Coupled phase-field variable
   const VariableValue & _phase;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 #endif // PIKACHEMICALPOTENTIALBC_H
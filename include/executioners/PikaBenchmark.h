@@ -0,0 +1,95 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKABENCHMARK_H
+#define PIKABENCHMARK_H
+
+// MOOSE includes
+#include "Transient.h"
+
+// Forward declarations
+class PikaBenchmark;
+
+template<>
+InputParameters validParams<PikaBenchmark>();
+
+/**
+ * An executioner for timing the objects in an input file without performing a solve
+ *
+ * After the usual transient setup a single timestep is prepared and the following are timed
+ * repeatedly:
+ *   - point evaluations of the PropertyUserObject methods used by PikaMaterial,
+ *   - complete residual evaluations,
+ *   - complete Jacobian evaluations, and
+ *   - evaluations of the AuxKernels executed on 'timestep_end'.
+ * Residual and Jacobian timings include the materials, so an input containing a single Kernel
+ * or BC measures the cost of that object; an input with only a MaterialRealAux measures the cost
+ * of the materials (see benchmarks/micro/material.i). The results, including the peak resident set size,
+ * are written as JSON for comparison across commits (see python/tools/runBenchmarks.py); in
+ * parallel the maximum over the processors of each timing and of the memory is reported.
+ */
+class PikaBenchmark : public Transient
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaBenchmark(const InputParameters & parameters);
+
+  /**
+   * Performs the timed evaluations in place of the time loop
+   */
+  virtual void execute() override;
+
+protected:
+
+  /**
+   * Times point evaluations of the PropertyUserObject methods
+   * @return The total time in seconds
+   */
+  Real timeProperties();
+
+  /**
+   * Times complete residual evaluations
+   * @return The total time in seconds
+   */
+  Real timeResidual();
+
+  /**
+   * Times complete Jacobian evaluations
+   * @return The total time in seconds
+   */
+  Real timeJacobian();
+
+  /**
+   * Times evaluations of the timestep_end AuxKernels
+   * @return The total time in seconds
+   */
+  Real timeAuxiliary();
+
+  /**
+   * Returns the peak resident set size of this process in kilobytes
+   */
+  static long peakMemory();
+
+  /// Number of evaluations to perform for each measurement
+  const unsigned int _property_evaluations;
+  const unsigned int _residual_evaluations;
+  const unsigned int _jacobian_evaluations;
+  const unsigned int _aux_evaluations;
+
+  /// The file to write the results
+  const std::string _benchmark_file;
+};
+
+#endif // PIKABENCHMARK_H
@@ -0,0 +1,70 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+
+#ifndef PIKACONVERGENCESTUDY_H
+#define PIKACONVERGENCESTUDY_H
+
+// MOOSE includes
+#include "Steady.h"
+
+// Forward declarations
+class PikaConvergenceStudy;
+
+template<>
+InputParameters validParams<PikaConvergenceStudy>();
+
+/**
+ * An executioner for mesh refinement convergence studies within a single run.
+ *
+ * The problem is solved on the initial mesh, which is then uniformly refined 'refinements' times
+ * in place; the solution is projected onto each refined mesh and used as the initial guess. After
+ * each solve the 'error_postprocessors' (e.g., ElementL2Error or a norm of an ErrorFunctionAux
+ * variable) are recorded and, since each refinement halves the element size, the observed rate
+ * between levels is log2(e_{l-1} / e_l). The errors, the rates and the least-squares rate over all
+ * levels are reported on the console and written to <file_base>_convergence.csv.
+ */
+class PikaConvergenceStudy : public Steady
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaConvergenceStudy(const InputParameters & parameters);
+
+  /**
+   * Performs the solves and refinements
+   */
+  virtual void execute() override;
+
+protected:
+
+  /**
+   * Writes the table of errors and observed rates
+   */
+  void report();
+
+  /// The number of uniform refinements
+  const unsigned int _refinements;
+
+  /// The postprocessors computing the error norms
+  const std::vector<PostprocessorName> & _error_names;
+
+  /// The number of degrees of freedom at each level
+  std::vector<dof_id_type> _num_dofs;
+
+  /// The error of each postprocessor (outer) at each level (inner)
+  std::vector<std::vector<Real>> _errors;
+};
+
+#endif // PIKACONVERGENCESTUDY_H
@@ -0,0 +1,103 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+
+#ifndef PIKAPARAREAL_H
+#define PIKAPARAREAL_H
+
+// MOOSE includes
+#include "Transient.h"
+
+// Forward declarations
+class PikaParareal;
+class MultiApp;
+
+template<>
+InputParameters validParams<PikaParareal>();
+
+/**
+ * A parareal (parallel-in-time) executioner.
+ *
+ * The interval [start_time, end_time] is divided into one time slice per sub-application of the
+ * 'fine_app' MultiApp; MOOSE distributes the sub-applications over the MPI ranks, so the fine
+ * propagators of all slices run concurrently. The coarse propagator is this application, which
+ * takes 'coarse_steps' per slice and may be a cheaper model, provided it has the same variables
+ * on the same mesh. Each iteration k updates the slice boundary states U_n as
+ *
+ *   U_{n+1}^{k+1} = G(U_n^{k+1}) + F(U_n^k) - G(U_n^k)
+ *
+ * until the largest change of a state is below 'tolerance'. The states are exchanged by node id,
+ * so the variables must be nodal (e.g., first order Lagrange), the meshes identical and replicated,
+ * and the solutions free of stateful material properties, as in the Ibex and Pika heat equations.
+ * The converged slice boundary states are output by this application.
+ */
+class PikaParareal : public Transient
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaParareal(const InputParameters & parameters);
+
+  /**
+   * Performs the parareal iterations in place of the time loop
+   */
+  virtual void execute() override;
+
+protected:
+
+  /**
+   * Advances a problem from the given state over [t0, t1] in uniform steps
+   * @return False if a step failed to converge
+   */
+  bool propagate(FEProblemBase & problem, const std::vector<Real> & state, Real t0, Real t1,
+                 unsigned int steps, std::vector<Real> & result);
+
+  /**
+   * Runs the fine propagators of the slices from 'first' on concurrently
+   */
+  void fineSweep(unsigned int first);
+
+  ///@{
+  /**
+   * Gathers or sets the nodal solution of a problem, the state is complete on all processors
+   */
+  static void getState(FEProblemBase & problem, std::vector<Real> & state);
+  static void setState(FEProblemBase & problem, const std::vector<Real> & state);
+  ///@}
+
+  /// The fine propagators, one sub-application per slice
+  std::shared_ptr<MultiApp> _fine_app;
+
+  /// Steps per slice of the propagators
+  const unsigned int _coarse_steps;
+  const unsigned int _fine_steps;
+
+  /// Iteration limits
+  const unsigned int _max_parareal_iterations;
+  const Real _parareal_tolerance;
+
+  /// The slice boundary times
+  std::vector<Real> _slice_times;
+
+  /// The slice boundary states U_n
+  std::vector<std::vector<Real>> _states;
+
+  /// The coarse propagation G(U_n) of the previous iteration, for the slice ending at n
+  std::vector<std::vector<Real>> _coarse;
+
+  /// The fine propagation F(U_n), for the slice ending at n
+  std::vector<std::vector<Real>> _fine;
+};
+
+#endif // PIKAPARAREAL_H
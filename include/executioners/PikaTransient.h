@@ -0,0 +1,97 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+
+#ifndef PIKATRANSIENT_H
+#define PIKATRANSIENT_H
+
+// MOOSE includes
+#include "Transient.h"
+
+// Forward declarations
+class PikaTransient;
+class PikaRepartition;
+class PikaPoreSubdomain;
+
+template<>
+InputParameters validParams<PikaTransient>();
+
+/**
+ * A Transient executioner with an optional quasi-steady initialization.
+ *
+ * With 'steady_initialization' enabled, a single implicit Euler step of length
+ * 'initialization_dt' is solved from the initial condition before the time loop. During this
+ * step every Kernel and IntegratedBC of the 'hold_variables' (typically the phase), except the
+ * time derivatives, is disabled, so these variables keep their initial values while the time
+ * derivatives of the remaining variables (temperature and chemical potential) vanish; the held
+ * variables are copied back from the old solution after the solve. The transient then starts from a state that is consistent with the diffusion operators and the
+ * full material model, and the time stepper can increase the timestep immediately.
+ *
+ * The executioner also performs the re-partition requested by a PikaRepartition object
+ * ('repartition') and the subdomain moves of a PikaPoreSubdomain object ('pore_subdomain'),
+ * after each timestep is complete and outside of the user object execution; moves requested by
+ * the initial execution are performed before the steady initialization.
+ */
+class PikaTransient : public Transient
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaTransient(const InputParameters & parameters);
+
+  /**
+   * Performs the initialization after the usual transient setup
+   */
+  virtual void init() override;
+
+  /**
+   * Moves the pore subdomain and re-partitions the mesh, if requested, after the timestep
+   */
+  virtual void postStep() override;
+
+protected:
+
+  /**
+   * Solves the quasi-steady problem with the held variables fixed
+   */
+  void steadyInitialization();
+
+  /**
+   * Disables the non-time objects acting on the held variables
+   * @return The objects that were disabled
+   */
+  std::vector<MooseObject *> holdVariables();
+
+  /**
+   * Resets the held variables to their initial values after the initialization solve
+   */
+  void restoreHeldVariables();
+
+  /// Flag for performing the initialization
+  const bool _steady_initialization;
+
+  /// The variables held at their initial values
+  const std::vector<NonlinearVariableName> & _hold_variables;
+
+  /// The step length of the initialization
+  const Real _initialization_dt;
+
+  /// The object requesting re-partitions of the mesh
+  PikaRepartition * _repartition;
+
+  /// The object requesting moves of the pore subdomain
+  PikaPoreSubdomain * _pore_subdomain;
+};
+
+#endif // PIKATRANSIENT_H
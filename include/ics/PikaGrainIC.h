@@ -0,0 +1,50 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+
+#ifndef PIKAGRAINIC_H
+#define PIKAGRAINIC_H
+
+// MOOSE includes
+#include "InitialCondition.h"
+
+// Forward declarations
+class PikaGrainIC;
+class PikaGrainCatalogue;
+
+template<>
+InputParameters validParams<PikaGrainIC>();
+
+/**
+ * Initial phase from the grains of a PikaGrainCatalogue
+ */
+class PikaGrainIC : public InitialCondition
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaGrainIC(const InputParameters & parameters);
+
+  /**
+   * Returns the phase at the point
+   */
+  virtual Real value(const Point & p);
+
+protected:
+
+  /// The grain catalogue
+  const PikaGrainCatalogue & _catalogue;
+};
+
+#endif // PIKAGRAINIC_H
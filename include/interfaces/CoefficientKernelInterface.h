@@ -61,6 +61,13 @@ protected:
    */
   libMesh::Real coefficient(unsigned int qp);
 
+  /**
+   * Tests that the coefficient is the same at all quadrature points of the current element
+   * @param n_qp The number of quadrature points, i.e., _qrule->n_points()
+   * @return True if the coefficient at each point matches coefficient(0)
+   */
+  bool uniformCoefficient(unsigned int n_qp);
+
   /// Flag indicating to use material property rather than scalar coefficient
   const bool _use_material;
 
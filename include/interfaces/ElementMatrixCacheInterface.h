@@ -0,0 +1,112 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef ELEMENTMATRIXCACHEINTERFACE_H
+#define ELEMENTMATRIXCACHEINTERFACE_H
+
+// STL includes
+#include <map>
+#include <vector>
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/point.h"
+
+// Forward declarations
+class ElementMatrixCacheInterface;
+class InputParameters;
+
+namespace libMesh
+{
+class Elem;
+}
+
+template<>
+InputParameters validParams<ElementMatrixCacheInterface>();
+
+/**
+ * A class providing a cache of element matrices for Kernels with a constant coefficient.
+ *
+ * On the structured meshes used by the snow problems (GeneratedMesh with uniform refinement)
+ * the elements are translations of a few reference geometries, so the element matrix of an
+ * operator with a constant coefficient is identical for each of them. The matrix is computed
+ * once per geometry and the residual is then applied as a small dense matrix-vector product,
+ * which is also the Jacobian-vector product used by JFNK.
+ *
+ * A geometry is identified by the offsets of the element nodes from the first node, compared
+ * up to a tolerance relative to the element size. This distinguishes, for example, the two
+ * orientations of the TRI3 elements of a GeneratedMesh, which share the volume and hmax. At most
+ * MAX_GEOMETRIES are cached for each element type; other elements return NULL from
+ * cachedElementMatrix and must be computed by the usual quadrature loop.
+ */
+class ElementMatrixCacheInterface
+{
+public:
+  ElementMatrixCacheInterface(const InputParameters & parameters);
+
+protected:
+
+  /**
+   * Flag for cache usage
+   * @return True when the element matrix cache is enabled
+   */
+  bool useElementMatrixCache() const;
+
+  /**
+   * Returns the cached matrix for the supplied element
+   * @param elem The current element
+   * @return A pointer to the cached matrix, NULL if the matrix is not cached for this element
+   */
+  const libMesh::DenseMatrix<libMesh::Real> * cachedElementMatrix(const libMesh::Elem * elem) const;
+
+  /**
+   * Creates a cache entry for the supplied element, the returned matrix must be populated by the caller
+   * @param elem The current element
+   * @return A pointer to the matrix to populate, NULL if no more geometries may be cached for this element type
+   */
+  libMesh::DenseMatrix<libMesh::Real> * addElementMatrix(const libMesh::Elem * elem);
+
+  /**
+   * Removes all cached matrices, this should be called when the mesh changes
+   */
+  void clearElementMatrixCache();
+
+private:
+
+  /// Storage for a cached matrix and the geometry it was computed with
+  struct CachedMatrix
+  {
+    libMesh::Real hmax;
+    std::vector<libMesh::Point> offsets;
+    libMesh::DenseMatrix<libMesh::Real> matrix;
+  };
+
+  /**
+   * Compares the geometry of an element with a cached entry
+   * @param elem The element to compare
+   * @param cached The cached entry
+   * @return True if the node offsets of the element match the cached offsets
+   */
+  static bool congruent(const libMesh::Elem * elem, const CachedMatrix & cached);
+
+  /// The maximum number of geometries cached for each element type
+  static const unsigned int MAX_GEOMETRIES = 8;
+
+  /// Flag indicating that the cache is enabled
+  const bool _use_element_matrix_cache;
+
+  /// The cached matrices, indexed by the element type
+  std::map<libMesh::ElemType, std::vector<CachedMatrix> > _element_matrix_cache;
+};
+
+#endif // ELEMENTMATRIXCACHEINTERFACE_H
@@ -0,0 +1,51 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKATIMERINTERFACE_H
+#define PIKATIMERINTERFACE_H
+
+// Pika includes
+#include "PikaTimers.h"
+
+// Forward declarations
+class MooseObject;
+
+/**
+ * Provides the timers for instrumenting the entry points of Pika objects, e.g.,
+ *
+ *   PikaScopedTimer timer(_pika_timers, _residual_timer, _tid);
+ *
+ * The timers are reported by the PikaTimerReport user object.
+ */
+class PikaTimerInterface
+{
+public:
+  PikaTimerInterface(const MooseObject * moose_object);
+
+protected:
+
+  /**
+   * Registers a timed section for this object
+   * @param section The name of the entry point (e.g., "computeResidual")
+   * @return The id to pass to PikaScopedTimer
+   */
+  unsigned int registerPikaTimer(const std::string & section);
+
+  /// The timers for the application
+  PikaTimers & _pika_timers;
+
+private:
+
+  /// Name of the object
+  const std::string & _pika_timer_object_name;
+};
+
+#endif // PIKATIMERINTERFACE_H
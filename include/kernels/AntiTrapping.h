@@ -18,6 +18,7 @@
 //PIKA Includes
 #include "PropertyUserObjectInterface.h"
 #include "CoefficientKernelInterface.h"
+#include "PikaTimerInterface.h"
 //Pika
 
 // Forward Declarations
@@ -37,7 +38,8 @@ InputParameters validParams<AntiTrapping>();
 
 class AntiTrapping :
   public Kernel,
-  public CoefficientKernelInterface
+  public CoefficientKernelInterface,
+  public PikaTimerInterface
 {
 public:
 
@@ -46,6 +48,14 @@ public:
    */
   AntiTrapping(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  ///@}
+
 protected:
 
   /**
@@ -72,6 +82,11 @@ private:
  const VariableGradient & _grad_phase;
  const Real & _w;
 
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 #endif // ANTITRAPPING_H
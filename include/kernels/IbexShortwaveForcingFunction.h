@@ -14,8 +14,15 @@
 
 #include "Kernel.h"
 
+#include <unordered_map>
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
 //Forward Declarations
 class IbexShortwaveForcingFunction;
+class IbexMeteorologicalForcing;
+class IbexSnowDepth;
 class Function;
 
 template<>
@@ -25,15 +32,50 @@ InputParameters validParams<IbexShortwaveForcingFunction>();
  * Define the Kernel for a user defined forcing function that looks like:
  *
  * test function * forcing function
+ *
+ * The incoming short-wave radiation is a Function or the 'short_wave' channel of an
+ * IbexMeteorologicalForcing object, which is read once per residual/Jacobian evaluation.
+ *
+ * The net short-wave flux at depth d, per unit incoming radiation, is summed over N bands
+ *
+ *   q(d) = sum_b f_b * (1 - albedo_b) * (1 - exp(-tau_b(d)))
+ *
+ * where tau_b is the optical depth integrated through layers with a piecewise constant
+ * extinction. The depth is computed by an IbexSnowDepth object or, if none is given, from the
+ * upper limit of the GeneratedMesh. The profile q is computed once per element and quadrature
+ * point and cached until the mesh changes; each residual only rescales it by the incoming flux.
  */
-class IbexShortwaveForcingFunction : public Kernel
+class IbexShortwaveForcingFunction :
+  public Kernel,
+  public PikaTimerInterface
 {
 public:
 
   IbexShortwaveForcingFunction(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  ///@}
+
   void initialSetup();
 
+  ///@{
+  /**
+   * Updates the incoming short-wave radiation from the forcing
+   */
+  virtual void residualSetup();
+  virtual void jacobianSetup();
+  ///@}
+
+  /**
+   * Clears the cached absorption profiles
+   */
+  virtual void meshChanged();
+
 protected:
 
   /**
@@ -41,16 +83,56 @@ protected:
    */
   virtual Real computeQpResidual();
 
+  /**
+   * Net flux per unit incoming radiation at the given depth
+   */
+  Real netFluxFraction(Real depth) const;
+
+  /**
+   * Sets _current_profile for the current element, computing it if needed
+   */
+  void setCurrentProfile();
+
 private:
 
-  const Function & _short_wave;
-  const Real _vis_extinction;
-  const Real _nir_extinction;
-  const Real _vis_albedo;
-  const Real _nir_albedo;
+  /// Incoming short-wave function, NULL when given by the forcing
+  const Function * _short_wave;
+
+  /// Optional meteorological forcing
+  const IbexMeteorologicalForcing * _forcing;
+
+  /// Incoming short-wave radiation from the forcing
+  Real _short_wave_in;
+
+  /// Fraction of the incoming radiation in each band
+  std::vector<Real> _band_fractions;
+
+  /// Albedo of each band
+  std::vector<Real> _band_albedos;
+
+  /// Bottom depth of each layer but the last
+  const std::vector<Real> _layer_depths;
+
+  /// Extinction coefficient of each band (outer) and layer (inner)
+  std::vector<std::vector<Real>> _extinction;
+
   const MooseEnum & _direction;
-  RealVectorValue _direction_vector;
   Real _surface;
+
+  /// Optional depth object
+  const IbexSnowDepth * _depth;
+
+  /// Cached net flux per unit incoming radiation, per element and quadrature point
+  std::unordered_map<dof_id_type, std::vector<Real>> _profiles;
+
+  /// The profile of the current element
+  const std::vector<Real> * _current_profile;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 #endif // IBEXSHORTWAVEFORCINGFUNCTION_H
@@ -18,6 +18,7 @@
 //Pika Includs
 #include "PropertyUserObjectInterface.h"
 #include "CoefficientKernelInterface.h"
+#include "PikaTimerInterface.h"
 //Forward Declarations
 class PhaseTransition;
 
@@ -26,12 +27,21 @@ InputParameters validParams<PhaseTransition>();
 
 class PhaseTransition :
   public ACBulk<Real>,
-  public CoefficientKernelInterface
+  public CoefficientKernelInterface,
+  public PikaTimerInterface
 {
 public:
 
   PhaseTransition(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  ///@}
+
 protected:
   virtual Real computeDFDOP(PFFunctionType type);
 
@@ -41,6 +51,12 @@ private:
   const MaterialProperty<Real> & _lambda;
 
   const MaterialProperty<Real> & _s_eq;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 #endif // PHASETRANSITION_H
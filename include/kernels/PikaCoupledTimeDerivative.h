@@ -25,7 +25,8 @@ InputParameters validParams<PikaCoupledTimeDerivative>();
  * A coefficient time derivative Kernel acting on a coupled variable
  *
  * This Kernel behaves exactly as PikaTimeDerivative, but instead the
- * time derivative is for a coupled variable.
+ * time derivative is for a coupled variable. When lumping is enabled the coupled variable
+ * must use the same finite element type as the variable.
  *
  * @see PikaTimeDerivative
  */
@@ -66,6 +67,9 @@ private:
   /// Time derivative of coupled variable
   const VariableValue & _var_dot;
 
+  /// Nodal values of the time derivative of the coupled variable, used for the lumped residual
+  const VariableValue & _var_dot_dofs;
+
   /// Derivative of time derivative of the coupled variable
   const VariableValue & _dvar_dot_dvar;
 
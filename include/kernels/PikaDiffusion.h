@@ -18,6 +18,8 @@
 // Pika includes
 #include "PropertyUserObjectInterface.h"
 #include "CoefficientKernelInterface.h"
+#include "ElementMatrixCacheInterface.h"
+#include "PikaTimerInterface.h"
 
 //Forward Declarations
 class PikaDiffusion;
@@ -39,10 +41,16 @@ InputParameters validParams<PikaDiffusion>();
  * as defined by Kaempfer and Plapp (2009). This temporal scalling is applied in
  * additions to the coefficient scaling:
  *     xi * (scale * coefficient + offset) * div(coefficient \nabla u)
+ *
+ * For constant coefficients on structured meshes the element stiffness matrix may be cached
+ * ('cache_element_matrix = true'), in which case the residual, and thus the JFNK Jacobian-vector
+ * product, is computed as a dense matrix-vector product rather than by quadrature.
  */
 class PikaDiffusion :
   public Diffusion,
-  public CoefficientKernelInterface
+  public CoefficientKernelInterface,
+  public ElementMatrixCacheInterface,
+  public PikaTimerInterface
 {
 public:
 
@@ -51,8 +59,30 @@ public:
    */
   PikaDiffusion(const InputParameters & parameters);
 
+  /**
+   * Checks that the cached stiffness matrices are valid for the coordinate system
+   */
+  virtual void initialSetup();
+
+  /**
+   * Clears the cached stiffness matrices
+   */
+  virtual void meshChanged();
+
 protected:
 
+  /**
+   * Compute the element residual
+   * Utilizes the cached stiffness matrix if available, otherwise Diffusion::computeResidual
+   */
+  virtual void computeResidual();
+
+  /**
+   * Compute the element Jacobian
+   * Utilizes the cached stiffness matrix if available, otherwise Diffusion::computeJacobian
+   */
+  virtual void computeJacobian();
+
   /**
    * Compute residual
    * Utilizes Diffusion::computeQpResidual with applied coefficients and scaling
@@ -65,6 +95,19 @@ protected:
    */
   virtual Real computeQpJacobian();
 
+private:
+
+  /**
+   * Returns the stiffness matrix (without coefficient) of the current element
+   * @return A pointer to the cached matrix, NULL if the cache is not used for the current element
+   */
+  const DenseMatrix<Real> * stiffnessMatrix();
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 #endif //MATDIFFUSION_H
@@ -16,18 +16,33 @@
 //PIKA Include
 #include "PropertyUserObjectInterface.h"
 #include "CoefficientKernelInterface.h"
+#include "PikaTimerInterface.h"
 
 class PikaHomogenizedKernel : public
   HomogenizedHeatConduction,
-  CoefficientKernelInterface
+  CoefficientKernelInterface,
+  public PikaTimerInterface
 {
 public:
 
   PikaHomogenizedKernel(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  ///@}
+
 protected:
   virtual Real computeQpResidual();
 
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 template<>
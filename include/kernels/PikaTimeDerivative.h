@@ -18,6 +18,8 @@
 // Pika includes
 #include "PropertyUserObjectInterface.h"
 #include "CoefficientKernelInterface.h"
+#include "ElementMatrixCacheInterface.h"
+#include "PikaTimerInterface.h"
 
 //Forward Declarations
 class PikaTimeDerivative;
@@ -39,10 +41,21 @@ InputParameters validParams<PikaTimeDerivative>();
  * as defined by Kaempfer and Plapp (2009). This temporal scaling is applied in
  * additions to the coefficient scaling:
  *     xi * (scale * coefficient + offset) * du/dt
+ *
+ * When 'lumping = true' both the residual and the Jacobian use the row-sum lumped mass
+ * matrix, i.e., the time derivative at each node is taken from the nodal value rather than
+ * interpolated at the quadrature points. This requires a Lagrange variable and allows the
+ * Kernel to be used with the ActuallyExplicitEuler time integrator.
+ *
+ * For constant coefficients on structured meshes the element mass matrix may be cached
+ * ('cache_element_matrix = true'), in which case the residual and Jacobian are computed
+ * from the cached matrix rather than by quadrature.
  */
 class PikaTimeDerivative :
   public TimeDerivative,
-  public CoefficientKernelInterface
+  public CoefficientKernelInterface,
+  public ElementMatrixCacheInterface,
+  public PikaTimerInterface
 {
 public:
 
@@ -51,8 +64,30 @@ public:
    */
   PikaTimeDerivative(const InputParameters & parameters);
 
+  /**
+   * Checks that the cached mass matrices are valid for the coordinate system
+   */
+  virtual void initialSetup();
+
+  /**
+   * Clears the cached mass matrices
+   */
+  virtual void meshChanged();
+
 protected:
 
+  /**
+   * Compute the element residual
+   * Utilizes the cached mass matrix if available, otherwise TimeDerivative::computeResidual
+   */
+  virtual void computeResidual();
+
+  /**
+   * Compute the element Jacobian
+   * Utilizes the cached mass matrix if available, otherwise TimeDerivative::computeJacobian
+   */
+  virtual void computeJacobian();
+
   /**
    * Compute residual
    * Utilizes TimeDerivative::computeQpResidual with applied coefficients and scaling
@@ -64,6 +99,23 @@ protected:
    * Utilizes TimeDerivative::computeQpJacobian with applied coefficients and scaling
    */
   virtual Real computeQpJacobian();
+
+  /// Nodal values of the time derivative, used for the lumped residual
+  const VariableValue & _u_dot_dofs;
+
+private:
+
+  /**
+   * Returns the mass matrix for the current element
+   * @return The cached mass matrix, NULL if the cache is disabled or does not apply to the current element
+   */
+  const DenseMatrix<Real> * massMatrix();
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 #endif //PIKATIMEDERIVATIVE
@@ -17,6 +17,7 @@
 //Pika includes
 #include "PropertyUserObjectInterface.h"
 #include "CoefficientKernelInterface.h"
+#include "PikaTimerInterface.h"
 // Forward declerations
 class TensorDiffusion;
 
@@ -28,8 +29,8 @@ InputParameters validParams<TensorDiffusion>();
  */
 class TensorDiffusion :
   public Diffusion,
-  public CoefficientKernelInterface
-
+  public CoefficientKernelInterface,
+  public PikaTimerInterface
 {
 public:
 
@@ -40,6 +41,14 @@ public:
    */
   TensorDiffusion(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  ///@}
+
   /**
    * Class destructor
    */
@@ -51,6 +60,12 @@ protected:
 
 private:
   const MaterialProperty<RealTensorValue> & _coef;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _residual_timer;
+  unsigned int _jacobian_timer;
+  ///@}
 };
 
 #endif //TENSORDIFFUSION_H
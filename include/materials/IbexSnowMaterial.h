@@ -15,16 +15,27 @@
 // MOOSE includes
 #include "Material.h"
 
+// Pika includes
+#include "PikaTimerInterface.h"
+
+#include <cmath>
+
 // Forward declerations
 class IbexSnowMaterial;
+class IbexStratigraphy;
 
 template<>
 InputParameters validParams<IbexSnowMaterial>();
 
 /**
+ * Snow density, thermal conductivity and specific heat.
  *
+ * The properties are uniform, or taken from the layer of an IbexStratigraphy object containing
+ * the current element, in which case the specific heat is interpolated from its table.
  */
-class IbexSnowMaterial : public Material
+class IbexSnowMaterial :
+  public Material,
+  public PikaTimerInterface
 {
 public:
 
@@ -34,6 +45,23 @@ public:
    */
   IbexSnowMaterial(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeProperties();
+  ///@}
+
+  /**
+   * Thermal conductivity estimated from the snow density [kg/m^3]
+   */
+  static Real densityConductivity(Real density) { return 0.021 + 2.5 * std::pow(density / 1000, 2); }
+
+  /**
+   * Specific heat estimated from the snow temperature [K]
+   */
+  static Real temperatureSpecificHeat(Real temperature) { return 1000 * (2.115 + 0.00779 * (273.15 - temperature)); }
+
 protected:
   void computeQpProperties();
 
@@ -57,6 +85,22 @@ private:
   bool _use_conductivity_variable;
   const VariableValue & _conductivity_variable;
 
+  /// Conductivity of the uniform density, computed once
+  const Real _density_conductivity;
+
+  /// Optional layered properties
+  const IbexStratigraphy * _stratigraphy;
+
+  /// Grain size, declared with the stratigraphy
+  MaterialProperty<Real> * _grain_size;
+
+  /// The layer of the current element
+  unsigned int _layer;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _properties_timer;
+  ///@}
 };
 
 #endif //IBEXSNOWMATERIAL_H
@@ -18,6 +18,9 @@
 // MOOSE includes
 #include "Material.h"
 
+// Pika includes
+#include "PikaTimerInterface.h"
+
 class PikaMaterial;
 
 template<>
@@ -28,11 +31,19 @@ InputParameters validParams<PikaMaterial>();
  */
 class PikaMaterial :
   public Material,
-  public PropertyUserObjectInterface
+  public PropertyUserObjectInterface,
+  public PikaTimerInterface
 {
 public:
   PikaMaterial(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeProperties();
+  ///@}
+
 protected:
   /**
    * Computes the various material properties for solving energy, mass, and phase equations
@@ -53,33 +64,12 @@ private:
   /// Interface thickness, W
   const Real & _interface_thickness;
 
-  /// Coefficient for capillary length coefficient, Eq. (37)
-  const Real _a_1;
-
   /// Density of ice
   const Real & _density_ice;
 
   /// Latent heat of sublimation
   const Real &  _l_sg;
 
-  /// Conductivity of ice
-  const Real & _ki;
-
-  /// Conductivity of air
-  const Real & _ka;
-
-  /// Heat capacity of ice
-  const Real & _ci;
-
-  /// Heat capacity of air
-  const Real & _ca;
-
-  /// Diffusion coefficient of water vapor
-  const Real & _dv;
-
-  /// Spatial scaling
-  const Real & _spatial_scale;
-
   /// Phase-field mobility
   const Real & _input_mobility;
 
@@ -124,6 +114,11 @@ private:
   MaterialProperty<Real> * _interface_kinetic_coefficient;
   MaterialProperty<Real> * _interface_kinetic_coefficient_prime;
   ///@}
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _properties_timer;
+  ///@}
 };
 
 #endif // PIKAMATERIAL_H
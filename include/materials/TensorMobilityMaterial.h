@@ -15,6 +15,9 @@
 // MOOSE includes
 #include "Material.h"
 
+// Pika includes
+#include "PikaTimerInterface.h"
+
 // Forward declerations
 class TensorMobilityMaterial;
 
@@ -24,7 +27,9 @@ InputParameters validParams<TensorMobilityMaterial>();
 /**
  *
  */
-class TensorMobilityMaterial : public Material
+class TensorMobilityMaterial :
+  public Material,
+  public PikaTimerInterface
 {
 public:
 
@@ -34,6 +39,13 @@ public:
    */
   TensorMobilityMaterial(const InputParameters & parameters);
 
+  ///@{
+  /**
+   * Timed entry points, see PikaTimerReport
+   */
+  virtual void computeProperties();
+  ///@}
+
   /**
    * Class destructor
    */
@@ -59,6 +71,11 @@ private:
   MaterialProperty<Real> & _M_parallel;
   MaterialProperty<Real> & _M_perpendicular;
   MaterialProperty<RealTensorValue> & _M_tensor;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _properties_timer;
+  ///@}
 };
 
 #endif //TENSORMOBILITYMATERIAL_H
@@ -0,0 +1,126 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKABANDOUTPUT_H
+#define PIKABANDOUTPUT_H
+
+// MOOSE includes
+#include "FileOutput.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaBandOutput;
+
+namespace libMesh
+{
+class System;
+}
+
+template<>
+InputParameters validParams<PikaBandOutput>();
+
+/**
+ * Writes the nodal fields near the ice/air interface only, with the full fields written at
+ * every 'full_interval' output as a checkpoint.
+ *
+ * The nodes of the elements where |phi| < 'band' at any node form the interface band; between
+ * checkpoints only the band values and, per variable, the count, min, max and mean of the bulk
+ * ice (phi > 0) and air nodes are written. Each processor writes its own nodes to
+ *
+ *   <file_base>_<full|band>_<output number>.<processor id>.bin[.gz]
+ *
+ * The format is described in python/tools/rebuildBandOutput.py, which rebuilds the full
+ * fields from the latest checkpoint and the band files. The node ids of a checkpoint are only
+ * valid until the mesh changes, so the output following a mesh change is always a checkpoint.
+ */
+class PikaBandOutput :
+  public FileOutput,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaBandOutput(const InputParameters & parameters);
+
+  /**
+   * Sets up the variables to write
+   */
+  virtual void initialSetup();
+
+  /**
+   * The name of the file for the current output
+   */
+  virtual std::string filename();
+
+  /**
+   * Forces a full checkpoint at the next output
+   */
+  virtual void meshChanged();
+
+protected:
+
+  /**
+   * Flag for writing the full fields at the current output
+   * @return True for a checkpoint output
+   */
+  bool fullOutput() const;
+
+  /**
+   * Writes the full or band file
+   */
+  virtual void output(const ExecFlagType & type);
+
+  /**
+   * Writes the data to the given binary stream
+   * @param out The stream to write
+   * @param full True when all local nodes are written
+   */
+  void write(std::ostream & out, bool full);
+
+  /// The phase-field variable name
+  const VariableName & _phase_name;
+
+  /// Half width of the interface band, in terms of |phi|
+  const Real _band;
+
+  /// Number of outputs between the full field checkpoints
+  const unsigned int _full_interval;
+
+  /// When true the values are written in single precision
+  const bool _single_precision;
+
+  /// When true the files are compressed
+  const bool _compress;
+
+  /// The names of the variables to write
+  std::vector<VariableName> _variable_names;
+
+  /// The system and variable number of each variable (the phase is first)
+  std::vector<std::pair<const System *, unsigned int>> _variables;
+
+  /// The number of outputs written
+  unsigned int _num_outputs;
+
+  /// When true the next output is a checkpoint, regardless of the 'full_interval'
+  bool _force_full;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _output_timer;
+  ///@}
+};
+
+#endif // PIKABANDOUTPUT_H
@@ -0,0 +1,73 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAINTERFACEPARTITIONER_H
+#define PIKAINTERFACEPARTITIONER_H
+
+// MOOSE includes
+#include "PetscExternalPartitioner.h"
+
+// Forward declarations
+class PikaInterfacePartitioner;
+
+template<>
+InputParameters validParams<PikaInterfacePartitioner>();
+
+/**
+ * A graph partitioner that weights elements by their proximity to the ice/air interface
+ *
+ * Elements near the interface carry the phase transition, anti-trapping, and criteria work
+ * and are refined by adaptivity, so they are much more expensive than the bulk ice and pore
+ * elements. Each element is weighted as
+ *
+ *     1 + (interface_weight - 1) * max(1 - phi^2)
+ *
+ * where the maximum is taken over the element nodes. Before the phase variable exists (i.e.,
+ * for the initial partition) and for elements without evaluable phase values, the weight of the
+ * nearest ancestor with values is used, or unity if none exists.
+ */
+class PikaInterfacePartitioner : public PetscExternalPartitioner
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaInterfacePartitioner(const InputParameters & parameters);
+
+  /**
+   * Create a copy of this partitioner, this is required by libMesh
+   */
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  /**
+   * Computes the weight of an element given its nodal phase values
+   * @param phi Phase values at the element nodes
+   * @param interface_weight The weight of an element on the interface, bulk elements have unit weight
+   */
+  static Real interfaceWeight(const std::vector<Real> & phi, Real interface_weight);
+
+protected:
+
+  /**
+   * Returns the interface based weight for the supplied element
+   */
+  virtual dof_id_type computeElementWeight(Elem & elem) override;
+
+  /// Name of the phase variable
+  const VariableName & _phase_name;
+
+  /// Weight of elements on the interface
+  const Real _interface_weight;
+};
+
+#endif // PIKAINTERFACEPARTITIONER_H
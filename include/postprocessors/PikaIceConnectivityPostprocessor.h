@@ -0,0 +1,61 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAICECONNECTIVITYPOSTPROCESSOR_H
+#define PIKAICECONNECTIVITYPOSTPROCESSOR_H
+
+// MOOSE includes
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class PikaIceConnectivityPostprocessor;
+class PikaIceConnectivity;
+
+// Input parameters
+template<>
+InputParameters validParams<PikaIceConnectivityPostprocessor>();
+
+/**
+ * Reports one of the ice network statistics computed by PikaIceConnectivity
+ */
+class PikaIceConnectivityPostprocessor : public GeneralPostprocessor
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaIceConnectivityPostprocessor(const InputParameters & parameters);
+
+  ///@{
+  /**
+   * The statistic is computed by the user object, these methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute(){}
+  ///@}
+
+  /**
+   * Returns the selected statistic
+   */
+  virtual Real getValue();
+
+protected:
+
+  /// The connectivity user object
+  const PikaIceConnectivity & _connectivity;
+
+  /// The statistic to report
+  const MooseEnum _quantity;
+};
+
+#endif // PIKAICECONNECTIVITYPOSTPROCESSOR_H
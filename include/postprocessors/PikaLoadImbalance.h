@@ -0,0 +1,69 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKALOADIMBALANCE_H
+#define PIKALOADIMBALANCE_H
+
+#include "ElementPostprocessor.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+//Forward Declarations
+class PikaLoadImbalance;
+
+// Input parameters
+template<>
+InputParameters validParams<PikaLoadImbalance>();
+
+/**
+ * Computes the ratio of the maximum to the mean processor load, where the load of each element
+ * is estimated by its proximity to the interface in the same manner as PikaInterfacePartitioner.
+ * A value of one indicates a perfect balance.
+ */
+class PikaLoadImbalance :
+  public ElementPostprocessor,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaLoadImbalance(const InputParameters & parameters);
+  virtual void initialize();
+  virtual void execute();
+  virtual Real getValue();
+  virtual void threadJoin(const UserObject & y);
+
+protected:
+
+  /// Nodal values of the phase-field variable
+  const VariableValue & _phase;
+
+  /// Weight of elements on the interface
+  const Real _interface_weight;
+
+  /// Storage for the nodal values passed to the weight calculation
+  std::vector<Real> _phi;
+
+  /// The load of the elements on this processor
+  Real _load;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  unsigned int _value_timer;
+  ///@}
+};
+
+#endif // PIKALOADIMBALANCE_H
@@ -0,0 +1,92 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAPHASESTABLETIMESTEP_H
+#define PIKAPHASESTABLETIMESTEP_H
+
+#include "ElementPostprocessor.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+//Forward Declarations
+class PikaPhaseStableTimeStep;
+
+// Input parameters
+template<>
+InputParameters validParams<PikaPhaseStableTimeStep>();
+
+/**
+ * Computes the largest stable forward Euler timestep for the lumped-mass phase-field equation
+ *
+ *   tau * dphi/dt = M * W^2 * lap(phi) - M * (phi^3 - phi) + ...
+ *
+ * which, for linear Lagrange elements, is limited by the diffusion term to
+ *
+ *   dt <= tau * h^2 / (2 * dim * M * W^2)
+ *
+ * where h is the minimum element dimension, and independently of h by the double-well
+ * (DoubleWellPotential) reaction term, whose derivative is at most 2 * M / tau in [-1, 1], to
+ *
+ *   dt <= tau / (2 * M)
+ *
+ * The minimum of both limits over all quadrature points, multiplied by the 'safety_factor', is
+ * returned; use it with the PostprocessorDT time stepper.
+ *
+ * The limit applies to an explicit integration of the phase alone. MOOSE integrates all of the
+ * nonlinear variables with the same TimeIntegrator, so the explicit path (ActuallyExplicitEuler
+ * with 'solve_type = lumped') is only available to inputs that solve the phase-field equation by
+ * itself, not to the coupled temperature, chemical potential and phase problem.
+ */
+class PikaPhaseStableTimeStep :
+  public ElementPostprocessor,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaPhaseStableTimeStep(const InputParameters & parameters);
+  virtual void initialize();
+  virtual void execute();
+  virtual Real getValue();
+  virtual void threadJoin(const UserObject & y);
+
+protected:
+
+  /// The relaxation time (tau)
+  const MaterialProperty<Real> & _tau;
+
+  /// The phase-field mobility (M)
+  const MaterialProperty<Real> & _mobility;
+
+  /// The squared interface thickness (W^2)
+  const MaterialProperty<Real> & _w_squared;
+
+  /// Factor applied to the stability limit
+  const Real _safety_factor;
+
+  /// The mesh dimension
+  const unsigned int _dim;
+
+  /// The minimum stable timestep
+  Real _min_dt;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  unsigned int _value_timer;
+  ///@}
+};
+
+#endif // PIKAPHASESTABLETIMESTEP_H
@@ -14,6 +14,9 @@
 
 #include "NodalVariablePostprocessor.h"
 
+// Pika includes
+#include "PikaTimerInterface.h"
+
 //Forward Declarations
 class PikaPhaseTimestepPostprocessor;
 
@@ -22,7 +25,9 @@ template<>
 InputParameters validParams<PikaPhaseTimestepPostprocessor>();
 
 /// A postprocessor for collecting the nodal min or max value
-class PikaPhaseTimestepPostprocessor : public NodalVariablePostprocessor
+class PikaPhaseTimestepPostprocessor :
+  public NodalVariablePostprocessor,
+  public PikaTimerInterface
 {
 public:
 
@@ -50,7 +55,11 @@ protected:
   Real _decrease_factor;
   Real _increase_factor;
 
-
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  unsigned int _value_timer;
+  ///@}
 };
 
 #endif // PIKAPHASETIMESTEPPOSTPROCESSOR_H
@@ -0,0 +1,86 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAPHASEPREDICTOR_H
+#define PIKAPHASEPREDICTOR_H
+
+// MOOSE includes
+#include "Predictor.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaPhasePredictor;
+
+template<>
+InputParameters validParams<PikaPhasePredictor>();
+
+/**
+ * Predicts the phase-field variable at the new timestep, the other variables start from the
+ * previous solution as usual.
+ *
+ * With 'method = extrapolation' the phase is extrapolated linearly from the two previous
+ * solutions. With 'method = advection' the interface is moved by the normal velocity computed
+ * by PikaInterfaceVelocity (positive for growing ice); assuming the equilibrium profile,
+ * |grad(phi)| = (1 - phi^2)/(sqrt(2)W), so the nodal update needs no gradients:
+ *
+ *   phi_{n+1} = phi_n + scale * dt * v_n * (1 - phi_n^2) / (sqrt(2)W)
+ *
+ * PikaInterfaceVelocity depends on gradients and is normally computed on a constant monomial
+ * variable; in that case v_n at a node is the average over the elements sharing the node.
+ *
+ * The prediction is clipped to [-1, 1]. Only the initial guess changes, not the converged
+ * solution.
+ */
+class PikaPhasePredictor :
+  public Predictor,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaPhasePredictor(const InputParameters & parameters);
+
+  /**
+   * Applies the prediction to the phase degrees of freedom of the solution
+   */
+  virtual void apply(NumericVector<Number> & sln);
+
+protected:
+
+  /**
+   * Returns the interface velocity at a node
+   * @param node The node
+   * @param v The velocity, set when it is defined
+   * @return False if the velocity is undefined at the node
+   */
+  bool nodalVelocity(const Node & node, Real & v);
+
+  /// The phase-field variable
+  const VariableName & _phase_name;
+
+  /// The prediction method
+  const MooseEnum _method;
+
+  /// The interface velocity variable, only used with 'method = advection'
+  const VariableName * _velocity_name;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _apply_timer;
+  ///@}
+};
+
+#endif // PIKAPHASEPREDICTOR_H
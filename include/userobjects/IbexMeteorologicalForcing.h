@@ -0,0 +1,139 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef IBEXMETEOROLOGICALFORCING_H
+#define IBEXMETEOROLOGICALFORCING_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// STL includes
+#include <deque>
+#include <fstream>
+
+// Forward declarations
+class IbexMeteorologicalForcing;
+
+template<>
+InputParameters validParams<IbexMeteorologicalForcing>();
+
+/**
+ * Streams a meteorological station record and interpolates the forcing channels once per
+ * timestep for IbexSurfaceFluxBC and IbexShortwaveForcingFunction.
+ *
+ * The record is read by the root processor in chunks of 'chunk_size' rows, only the rows
+ * bracketing the current time are kept, and the interpolated values are broadcast to the other
+ * processors. The file is either CSV, with a header naming the columns, or raw native float64
+ * records with the columns named by 'binary_columns'. Channels without a column are not
+ * provided and the objects using this forcing fall back to their own parameters.
+ */
+class IbexMeteorologicalForcing :
+  public GeneralUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /// The forcing channels
+  enum Channel
+  {
+    AIR_TEMPERATURE = 0,
+    RELATIVE_HUMIDITY,
+    ATMOSPHERIC_PRESSURE,
+    AIR_VELOCITY,
+    LONG_WAVE,
+    SHORT_WAVE,
+    NUM_CHANNELS
+  };
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  IbexMeteorologicalForcing(const InputParameters & parameters);
+
+  ///@{
+  /**
+   * Interpolates the channels to the current time (execute), other methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute();
+  virtual void finalize(){}
+  ///@}
+
+  /**
+   * True if the record contains the channel
+   */
+  bool hasChannel(Channel channel) const { return _column[channel] >= 0; }
+
+  /**
+   * The value of the channel at the current time, in the units of the record
+   */
+  Real value(Channel channel) const { return _values[channel]; }
+
+protected:
+
+  /**
+   * Opens the file (root processor only) and locates the columns
+   */
+  void open();
+
+  /**
+   * Reads up to 'chunk_size' rows into the buffer, returns false at the end of the file
+   */
+  bool readChunk();
+
+  /// The name of the record file
+  const FileName & _file;
+
+  /// True for binary records
+  const bool _binary;
+
+  /// Number of rows read at a time
+  const unsigned int _chunk_size;
+
+  ///@{
+  /// Record time = time_scale * (simulation time) + time_offset
+  const Real _time_offset;
+  const Real _time_scale;
+  ///@}
+
+  /// The column of the time and each channel (-1 if not present)
+  int _time_column;
+  std::vector<int> _column;
+
+  /// Number of columns in the file
+  unsigned int _num_columns;
+
+  /// The open file (root processor only)
+  std::ifstream _stream;
+
+  /// The buffered rows (time followed by the channels)
+  std::deque<std::vector<Real>> _buffer;
+
+  /// Number of rows removed from the front of the buffer since the file was opened
+  unsigned long _rows_discarded;
+
+  /// True when the end of the file was reached
+  bool _eof;
+
+  /// The interpolated channel values
+  std::vector<Real> _values;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  ///@}
+};
+
+#endif // IBEXMETEOROLOGICALFORCING_H
@@ -0,0 +1,102 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef IBEXSNOWDEPTH_H
+#define IBEXSNOWDEPTH_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class IbexSnowDepth;
+class KDTree;
+
+template<>
+InputParameters validParams<IbexSnowDepth>();
+
+/**
+ * Computes the depth below the snow surface, for use with meshes of arbitrary shape.
+ *
+ * The nodes of the 'surface' boundary are gathered, projected onto the plane normal to the
+ * 'direction' (up), and stored in a KD-tree whenever the mesh changes. The depth of a point is
+ * the height of the nearest surface node, in the projected plane, minus the height of the point.
+ */
+class IbexSnowDepth :
+  public GeneralUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  IbexSnowDepth(const InputParameters & parameters);
+
+  /**
+   * Class destructor
+   */
+  virtual ~IbexSnowDepth();
+
+  ///@{
+  /**
+   * Builds the surface search tree
+   */
+  virtual void initialSetup();
+  virtual void meshChanged();
+  ///@}
+
+  ///@{
+  /**
+   * The depth is only updated when the mesh changes, these methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute(){}
+  virtual void finalize(){}
+  ///@}
+
+  /**
+   * The depth of the point below the surface (zero above the surface)
+   */
+  Real depth(const Point & p) const;
+
+  /**
+   * The upward direction (0, 1 or 2)
+   */
+  unsigned int direction() const { return _direction; }
+
+protected:
+
+  /// The surface boundary names
+  const std::vector<BoundaryName> & _surface;
+
+  /// The upward direction
+  const unsigned int _direction;
+
+  /// The surface nodes projected on the plane normal to the direction
+  std::vector<Point> _projected;
+
+  /// The height of each surface node
+  std::vector<Real> _height;
+
+  /// Search tree for the projected surface nodes
+  std::unique_ptr<KDTree> _tree;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _mesh_changed_timer;
+  ///@}
+};
+
+#endif // IBEXSNOWDEPTH_H
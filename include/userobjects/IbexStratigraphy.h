@@ -0,0 +1,133 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+
+#ifndef IBEXSTRATIGRAPHY_H
+#define IBEXSTRATIGRAPHY_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+#include <unordered_map>
+
+// Forward declarations
+class IbexStratigraphy;
+class IbexSnowDepth;
+
+template<>
+InputParameters validParams<IbexStratigraphy>();
+
+/**
+ * Layered snowpack properties loaded from a stratigraphy profile.
+ *
+ * The profile is a CSV file with one row per layer, from the surface down: the bottom 'depth' of
+ * the layer, its 'density' and 'grain_size' and, optionally, its 'thermal_conductivity' (estimated
+ * from the density if omitted). Each element is assigned to the layer containing its centroid
+ * when the mesh changes, so materials look up the layer properties directly. The temperature
+ * dependent specific heat is tabulated on a uniform temperature grid.
+ */
+class IbexStratigraphy :
+  public GeneralUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  IbexStratigraphy(const InputParameters & parameters);
+
+  ///@{
+  /**
+   * Maps the elements to the layers
+   */
+  virtual void initialSetup();
+  virtual void meshChanged();
+  ///@}
+
+  ///@{
+  /**
+   * The layers are only mapped when the mesh changes, these methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute(){}
+  virtual void finalize(){}
+  ///@}
+
+  /**
+   * The layer containing the element
+   */
+  unsigned int layer(const Elem * elem) const;
+
+  ///@{
+  /**
+   * Properties of a layer
+   */
+  Real density(unsigned int layer) const { return _density[layer]; }
+  Real grainSize(unsigned int layer) const { return _grain_size[layer]; }
+  Real conductivity(unsigned int layer) const { return _conductivity[layer]; }
+  ///@}
+
+  /**
+   * Specific heat at the given temperature, linearly interpolated in the table [J/(kg K)]
+   */
+  Real specificHeat(Real temperature) const;
+
+  /**
+   * Number of layers
+   */
+  unsigned int numLayers() const { return _bottom.size(); }
+
+protected:
+
+  /**
+   * The layer containing the given depth
+   */
+  unsigned int layerAtDepth(Real depth) const;
+
+  /// Optional depth object
+  const IbexSnowDepth * _depth;
+
+  /// The upward direction
+  const unsigned int _direction;
+
+  /// The surface height, used without a depth object
+  Real _surface;
+
+  ///@{
+  /// The layer properties
+  std::vector<Real> _bottom;
+  std::vector<Real> _density;
+  std::vector<Real> _grain_size;
+  std::vector<Real> _conductivity;
+  ///@}
+
+  /// The layer of each element
+  std::unordered_map<dof_id_type, unsigned int> _element_layer;
+
+  ///@{
+  /// Uniform specific heat table
+  const Real _cp_min;
+  Real _cp_delta;
+  std::vector<Real> _cp_table;
+  ///@}
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _mesh_changed_timer;
+  ///@}
+};
+
+#endif // IBEXSTRATIGRAPHY_H
@@ -0,0 +1,140 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+
+#ifndef PIKAGRAINCATALOGUE_H
+#define PIKAGRAINCATALOGUE_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+#include <array>
+#include <unordered_map>
+
+// Forward declarations
+class PikaGrainCatalogue;
+
+template<>
+InputParameters validParams<PikaGrainCatalogue>();
+
+/**
+ * A procedural catalogue of randomly placed spherical or ellipsoidal ice grains.
+ *
+ * The box is divided into a uniform grid of cells no smaller than the largest grain plus the
+ * interface width. The grains of each cell are drawn from a random stream seeded by a hash of the
+ * 'seed' and the cell index, so any processor can generate any cell and the microstructure is
+ * independent of the partitioning: each processor generates only the cells covering its portion of
+ * the mesh. The phase at a point is found from the grains of the neighbouring cells,
+ *
+ *   phi = max_g tanh(d_g / (sqrt(2) W))
+ *
+ * where d_g is the signed distance to the surface of grain g (approximated for ellipsoids).
+ */
+class PikaGrainCatalogue :
+  public GeneralUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaGrainCatalogue(const InputParameters & parameters);
+
+  /**
+   * Sets up the cells and generates the grains of the local cells
+   */
+  virtual void initialSetup();
+
+  ///@{
+  /**
+   * The grains are generated once, these methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute(){}
+  virtual void finalize(){}
+  ///@}
+
+  /**
+   * The phase at the given point, 1 in ice and -1 in air
+   */
+  Real phase(const Point & p) const;
+
+protected:
+
+  /**
+   * A single grain
+   */
+  struct Grain
+  {
+    /// The center
+    Point center;
+
+    /// Rotation into the grain axes, scaled by the inverse semi-axes
+    RealTensorValue transform;
+
+    /// The smallest semi-axis
+    Real min_axis;
+  };
+
+  /**
+   * Draws the grains of a cell
+   */
+  void generate(const std::array<int, 3> & cell, std::vector<Grain> & grains) const;
+
+  /**
+   * Unique key of a cell
+   */
+  std::size_t key(const std::array<int, 3> & cell) const;
+
+  /// The box containing the grain centers
+  Point _bottom_left;
+  Point _top_right;
+
+  /// The number of grains per unit volume
+  Real _number_density;
+
+  /// The mean radius and the relative variation of the radius
+  const Real _radius;
+  const Real _radius_variation;
+
+  /// The largest ratio of the longest to the shortest semi-axis (one for spheres)
+  const Real _aspect_ratio;
+
+  /// The random seed
+  const unsigned int _seed;
+
+  /// The mesh dimension
+  const unsigned int _dim;
+
+  /// The interface scale sqrt(2) W
+  Real _sqrt2_W;
+
+  ///@{
+  /// The cell grid
+  std::array<int, 3> _num_cells;
+  Point _cell_size;
+  ///@}
+
+  /// The grains of the local cells
+  std::unordered_map<std::size_t, std::vector<Grain>> _cells;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _initial_setup_timer;
+  ///@}
+};
+
+#endif // PIKAGRAINCATALOGUE_H
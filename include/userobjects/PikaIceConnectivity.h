@@ -0,0 +1,114 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAICECONNECTIVITY_H
+#define PIKAICECONNECTIVITY_H
+
+// MOOSE includes
+#include "ElementUserObject.h"
+
+// libMesh includes
+#include "libmesh/bounding_box.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaIceConnectivity;
+
+template<>
+InputParameters validParams<PikaIceConnectivity>();
+
+/**
+ * Labels the connected ice components (elements with a mean phase above 'threshold' that share
+ * a face) of the distributed mesh.
+ *
+ * Each processor labels its own elements with a union-find, the labels of faces shared with
+ * other processors are exchanged with their owners and the resulting (small) component graph is
+ * merged on every processor. Adapted meshes are supported by connecting elements to the active
+ * descendants of refined neighbors. The results are reported by PikaIceConnectivityPostprocessor.
+ */
+class PikaIceConnectivity :
+  public ElementUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaIceConnectivity(const InputParameters & parameters);
+
+  virtual void initialSetup();
+  virtual void meshChanged();
+  virtual void initialize();
+  virtual void execute();
+  virtual void threadJoin(const UserObject & y);
+  virtual void finalize();
+
+  ///@{
+  /**
+   * Component statistics, available after finalize
+   */
+  unsigned int numComponents() const { return _num_components; }
+  Real largestComponentVolume() const { return _largest_volume; }
+  Real meanComponentVolume() const;
+  Real iceVolume() const { return _ice_volume; }
+  Real totalVolume() const { return _total_volume; }
+  unsigned int numPercolatingComponents(unsigned int axis) const;
+  ///@}
+
+protected:
+
+  /// Per element data collected during execute
+  struct ElementData
+  {
+    bool ice;
+    Real volume;
+    unsigned int touches;
+  };
+
+  /// The phase-field variable
+  const VariableValue & _phase;
+
+  /// The phase value separating ice from air
+  const Real _threshold;
+
+  /// Bounding box of the mesh, used to detect percolating components
+  BoundingBox _bbox;
+
+  /// Element data for the local elements
+  std::map<dof_id_type, ElementData> _elements;
+
+  /// Total mesh volume
+  Real _total_volume;
+
+  /// Ice volume
+  Real _ice_volume;
+
+  /// Number of components
+  unsigned int _num_components;
+
+  /// Volume of the largest component
+  Real _largest_volume;
+
+  /// Number of components connecting the opposite faces of the bounding box, per axis
+  std::vector<unsigned int> _num_percolating;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  unsigned int _finalize_timer;
+  ///@}
+};
+
+#endif // PIKAICECONNECTIVITY_H
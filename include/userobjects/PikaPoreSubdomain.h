@@ -0,0 +1,124 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+
+#ifndef PIKAPORESUBDOMAIN_H
+#define PIKAPORESUBDOMAIN_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaPoreSubdomain;
+class PropertyUserObject;
+
+template<>
+InputParameters validParams<PikaPoreSubdomain>();
+
+/**
+ * Moves the elements between a pore and an ice subdomain as the phase evolves.
+ *
+ * An element whose nodal phase values all exceed 'threshold' lies in the interior of the ice and
+ * is assigned to the 'ice_subdomain', all others (pore space and interface band) are assigned to
+ * the 'pore_subdomain'. When an element changes subdomain the equation systems are reinitialized,
+ * so a chemical potential variable, and its Kernels, restricted to the pore subdomain carry no
+ * degrees of freedom inside the ice, where the diffusion coefficient vanishes. Both subdomains
+ * must exist in the mesh and the materials must be defined on both.
+ *
+ * The mesh may not change while the user objects are executing, so execute only records the
+ * moves; the PikaTransient executioner ('pore_subdomain' parameter) calls move after the initial
+ * execution and after each timestep. The degrees of freedom of the 'chemical_potential' created
+ * by the move, at nodes that join the pore space, are set to the value of
+ * PikaChemicalPotentialIC, u_eq(T)(1-phi)/2, in the current and old solutions.
+ */
+class PikaPoreSubdomain :
+  public GeneralUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaPoreSubdomain(const InputParameters & parameters);
+
+  /**
+   * Checks that the executioner performs the moves and the initialized variables
+   */
+  virtual void initialSetup();
+
+  ///@{
+  /**
+   * Records the local elements that change subdomain (execute), other methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute();
+  virtual void finalize(){}
+  ///@}
+
+  /**
+   * The number of elements moved by the last execution
+   */
+  dof_id_type numChanged() const { return _num_changed; }
+
+  /**
+   * Flag for pending moves
+   * @return True if elements changed subdomain when last executed
+   */
+  bool moveRequested() const;
+
+  /**
+   * Reassigns the elements, reinitializes the systems, and initializes the new chemical potential
+   * degrees of freedom; this must be called outside of the user object execution (see
+   * PikaTransient::postStep)
+   */
+  void move();
+
+protected:
+
+  /**
+   * Sets the chemical potential at the given nodes, where it was not defined before the move
+   * @param nodes The ids of the nodes to initialize
+   */
+  void initializeChemicalPotential(const std::set<dof_id_type> & nodes);
+
+  /// The phase variable name
+  const VariableName & _phase_name;
+
+  /// The subdomains
+  const SubdomainID _pore_id;
+  const SubdomainID _ice_id;
+
+  /// Elements with all nodal phase values above the threshold are ice
+  const Real _threshold;
+
+  /// The chemical potential and temperature variable names, empty if not initialized
+  const VariableName _chemical_potential_name;
+  const VariableName _temperature_name;
+
+  /// The elements that change subdomain, as (id, subdomain) pairs
+  std::vector<std::pair<dof_id_type, SubdomainID>> _changes;
+
+  /// The number of elements moved by the last execution
+  dof_id_type _num_changed;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  unsigned int _move_timer;
+  ///@}
+};
+
+#endif // PIKAPORESUBDOMAIN_H
@@ -0,0 +1,94 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAREPARTITION_H
+#define PIKAREPARTITION_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaRepartition;
+
+template<>
+InputParameters validParams<PikaRepartition>();
+
+/**
+ * Re-partitions the mesh when the measured load imbalance exceeds a threshold
+ *
+ * The imbalance is supplied by a postprocessor (e.g., PikaLoadImbalance) and the partition is
+ * recomputed by the partitioner of the mesh, which should be PikaInterfacePartitioner so that
+ * the new partition accounts for the current location of the interface.
+ *
+ * The mesh may not change while the user objects are executing, so execute only records the
+ * request; the PikaTransient executioner ('repartition' parameter) calls repartition after the
+ * timestep is complete, in the same manner as mesh adaptivity.
+ */
+class PikaRepartition :
+  public GeneralUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaRepartition(const InputParameters & parameters);
+
+  /**
+   * Checks that the executioner performs the re-partition
+   */
+  virtual void initialSetup();
+
+  ///@{
+  /**
+   * Requests a re-partition (execute) if the imbalance is too large, other methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute();
+  virtual void finalize(){}
+  ///@}
+
+  /**
+   * Flag for a pending re-partition
+   * @return True if the imbalance exceeded the threshold when last executed
+   */
+  bool repartitionRequested() const;
+
+  /**
+   * Re-partitions and redistributes the mesh, this must be called outside of the user object
+   * execution (see PikaTransient::postStep)
+   */
+  void repartition();
+
+protected:
+
+  /// The measured load imbalance
+  const PostprocessorValue & _imbalance;
+
+  /// The imbalance that triggers a re-partition
+  const Real _threshold;
+
+  /// Flag indicating that a re-partition is pending
+  bool _requested;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  unsigned int _repartition_timer;
+  ///@}
+};
+
+#endif // PIKAREPARTITION_H
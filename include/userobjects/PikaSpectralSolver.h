@@ -0,0 +1,178 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKASPECTRALSOLVER_H
+#define PIKASPECTRALSOLVER_H
+
+// STL includes
+#include <complex>
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Pika includes
+#include "PikaFFT.h"
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaSpectralSolver;
+class PropertyUserObject;
+class Function;
+
+template<>
+InputParameters validParams<PikaSpectralSolver>();
+
+/**
+ * Semi-implicit Fourier-spectral solver for the coupled T/u/phi equations on a periodic box.
+ *
+ * The fields are stored on a regular grid spanning the mesh bounding box and advanced each
+ * timestep, in the order phi, T, u, with a stabilized semi-implicit scheme:
+ *
+ *   f^{n+1} = f^n + dt * F[N(f^n)] / (1 + dt * alpha * |k|^2)
+ *
+ * where N is the right-hand side of the equation computed pseudo-spectrally (gradients in
+ * Fourier space, products on the grid) and alpha is the maximum diffusivity of the equation.
+ * The equations are the same as those solved by the Pika kernels:
+ *
+ *   tau dphi/dt = M * [W^2 lap(phi) + (phi - phi^3) + lambda * (u - u_eq) * (1 - phi^2)^2]
+ *   C dT/dt     = div(xi * kappa grad(T)) + xi * L_sg / 2 * dphi/dt
+ *   du/dt       = div(xi * D grad(u)) - xi / 2 * dphi/dt
+ *
+ * with all of the properties computed by the PropertyUserObject. The fields are mapped to
+ * the mesh with PikaSpectralAux so that the existing postprocessors and outputs may be used;
+ * the mesh may be much coarser than the spectral grid.
+ *
+ * The grid is not distributed, so this object produces an error for more than one MPI process; it is
+ * intended for threaded runs on a single node.
+ */
+class PikaSpectralSolver :
+  public GeneralUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaSpectralSolver(const InputParameters & parameters);
+
+  /**
+   * Samples the initial fields from the supplied functions
+   */
+  virtual void initialSetup();
+
+  ///@{
+  /**
+   * Advances the fields by a single timestep (execute), other methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute();
+  virtual void finalize(){}
+  ///@}
+
+  /**
+   * Returns the periodic, linearly interpolated value of a field at the supplied point
+   * @param field The field (0 = temperature, 1 = chemical_potential, 2 = phase)
+   * @param p The point at which to evaluate the field
+   */
+  Real value(unsigned int field, const Point & p) const;
+
+protected:
+
+  /**
+   * Computes the Laplacian of a field
+   * @param f The field
+   * @param out The Laplacian of the field
+   */
+  void laplacian(const std::vector<Real> & f, std::vector<Real> & out);
+
+  /**
+   * Computes div(coef * grad(f))
+   * @param f The field
+   * @param coef The variable coefficient
+   * @param out The resulting divergence
+   */
+  void divergence(const std::vector<Real> & f, const std::vector<Real> & coef, std::vector<Real> & out);
+
+  /**
+   * Applies the stabilized semi-implicit update to a field
+   * @param f The field to update
+   * @param rate The explicit rate of change of the field
+   * @param alpha The stabilization diffusivity
+   */
+  void update(std::vector<Real> & f, const std::vector<Real> & rate, Real alpha);
+
+  /// The PropertyUserObject, this is retrieved in initialSetup because it is created after this object
+  const PropertyUserObject * _property_uo;
+
+  /// Initial condition functions
+  Function & _phase_function;
+  Function & _temperature_function;
+  Function * _chemical_potential_function;
+
+  /// Mesh dimension
+  const unsigned int _dim;
+
+  /// Number of grid points in each direction
+  std::vector<unsigned int> _n;
+
+  /// Total number of grid points
+  std::size_t _size;
+
+  /// Origin and grid spacing in each direction
+  Point _origin;
+  std::vector<Real> _h;
+
+  /// Wavenumbers in each direction for first derivatives (zero for the Nyquist mode)
+  std::vector<std::vector<Real> > _k;
+
+  /// Squared wavenumber magnitude at each grid point
+  std::vector<Real> _k2;
+
+  /// The transform
+  PikaFFT _fft;
+
+  ///@{
+  /// The solution fields
+  std::vector<Real> _temperature;
+  std::vector<Real> _chemical_potential;
+  std::vector<Real> _phase;
+  ///@}
+
+  ///@{
+  /// Work arrays
+  std::vector<Real> _phase_dot;
+  std::vector<Real> _rate;
+  std::vector<Real> _coef;
+  std::vector<Real> _scratch;
+  std::vector<std::complex<Real> > _f_hat;
+  std::vector<std::complex<Real> > _g_hat;
+  std::vector<std::complex<Real> > _sum_hat;
+  ///@}
+
+  /// The last timestep that was computed, this prevents advancing twice in a single step
+  int _last_step;
+
+private:
+
+  /**
+   * Helper for building the FFT grid size from the input parameters
+   */
+  static std::vector<unsigned int> gridSize(const InputParameters & parameters);
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  ///@}
+};
+
+#endif // PIKASPECTRALSOLVER_H
@@ -0,0 +1,91 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKATIMERREPORT_H
+#define PIKATIMERREPORT_H
+
+// STL includes
+#include <map>
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Forward declarations
+class PikaTimerReport;
+class PikaTimers;
+
+template<>
+InputParameters validParams<PikaTimerReport>();
+
+/**
+ * Enables the Pika object timers and reports the results
+ *
+ * At the end of the simulation a table of the calls and time of each instrumented entry point
+ * is printed; the times are the maximum over the processors and the calls are the total. The
+ * time spent in each section during each timestep may also be written to a CSV file.
+ */
+class PikaTimerReport : public GeneralUserObject
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaTimerReport(const InputParameters & parameters);
+
+  ///@{
+  /**
+   * Writes the per-step data or the final summary (execute), other methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute();
+  virtual void finalize(){}
+  ///@}
+
+protected:
+
+  /**
+   * Gathers the calls and seconds of each section over the threads and processors, the sections
+   * are matched by name and the names are stored in _objects and _sections
+   */
+  void gather(std::vector<Real> & calls, std::vector<Real> & seconds);
+
+  /**
+   * Prints the summary table to the console
+   */
+  void printSummary(const std::vector<Real> & calls, const std::vector<Real> & seconds);
+
+  /**
+   * Writes the time spent in each section since the last call to the CSV file
+   */
+  void writeStep(const std::vector<Real> & seconds);
+
+  /// The timers being reported
+  PikaTimers & _timers;
+
+  /// Flag for writing the per-step CSV file
+  const bool _per_step_csv;
+
+  /// The CSV file name
+  const std::string _csv_file;
+
+  ///@{
+  /// The object and section names of the gathered data, the union over all processors
+  std::vector<std::string> _objects;
+  std::vector<std::string> _sections;
+  ///@}
+
+  /// The times of the previous step for each object/section, used for computing the per-step times
+  std::map<std::string, Real> _previous_seconds;
+};
+
+#endif // PIKATIMERREPORT_H
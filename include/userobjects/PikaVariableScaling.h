@@ -0,0 +1,97 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAVARIABLESCALING_H
+#define PIKAVARIABLESCALING_H
+
+// MOOSE includes
+#include "GeneralUserObject.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaVariableScaling;
+class PropertyUserObject;
+
+template<>
+InputParameters validParams<PikaVariableScaling>();
+
+/**
+ * Sets the residual scaling of the Pika variables from the physical properties, the finest
+ * element size (h) and the timestep (dt), so that the diagonal of the scaled Jacobian is of
+ * order one for each equation:
+ *
+ *   T:   1 / (C_i/dt + xi*k_i/h^2)
+ *   u:   1 / (1/dt + xi*D_v/h^2)
+ *   phi: 1 / (tau/dt + M*W^2/h^2)
+ *
+ * Dividing each equation by its characteristic magnitude is the equation part of a consistent
+ * nondimensionalization: it changes the conditioning of the Jacobian, not the solution. The
+ * unknowns are not rescaled, so every Kernel, BC, IC and AuxKernel, and all of the output,
+ * remain in SI units without conversion.
+ *
+ * The properties are evaluated at the reference temperature using the PropertyUserObject
+ * created by PikaMaterials. The factors are computed with the timestep of the first step and
+ * recomputed only when the finest element size changes (e.g., by adaptivity); a residual
+ * tolerance such as 'nl_abs_tol' thus applies to the same scaled residual until the mesh
+ * changes, regardless of the timestep. Solves before the timestep is known (e.g., the
+ * PikaTransient steady initialization) are unscaled. This object is created by PikaMaterials
+ * when 'automatic_scaling = true'.
+ */
+class PikaVariableScaling :
+  public GeneralUserObject,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaVariableScaling(const InputParameters & parameters);
+
+  virtual void initialSetup();
+  virtual void meshChanged();
+
+  ///@{
+  /**
+   * Computes the scaling factors (execute), other methods are not used
+   */
+  virtual void initialize(){}
+  virtual void execute();
+  virtual void finalize(){}
+  ///@}
+
+protected:
+
+  /**
+   * Sets the scaling factor of a variable, if it exists
+   */
+  void setScaling(const std::string & param, Real factor);
+
+  /// The PropertyUserObject, set in initialSetup
+  const PropertyUserObject * _property_uo;
+
+  /// The smallest element dimension
+  Real _h_min;
+
+  /// Flag indicating that the factors must be computed, set initially and when h changes
+  bool _update;
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _mesh_changed_timer;
+  unsigned int _execute_timer;
+  ///@}
+};
+
+#endif // PIKAVARIABLESCALING_H
@@ -97,6 +97,31 @@ public:
 
   Real equilibriumChemicalPotential(const Real & T) const;
 
+  /**
+   * Computes the phase-field coupling constant (lambda; Eq. (37))
+   * @param T The current temperature
+   * @param rho_vs Equilibrium water vapor concentration at saturation for the current temperature
+   */
+  Real phaseFieldCouplingConstant(const Real & T, const Real & rho_vs) const;
+
+  /**
+   * Computes the phase-field relaxation time (tau; Eq. (38))
+   * @param T The current temperature
+   * @param rho_vs Equilibrium water vapor concentration at saturation for the current temperature
+   * @param lambda The phase-field coupling constant, see phaseFieldCouplingConstant
+   */
+  Real relaxationTime(const Real & T, const Real & rho_vs, const Real & lambda) const;
+
+  ///@{
+  /**
+   * Phase-adjusted properties, including the spatial scaling
+   * @param phi The phase-field value
+   */
+  Real conductivity(const Real & phi) const;
+  Real heatCapacity(const Real & phi) const;
+  Real diffusionCoefficient(const Real & phi) const;
+  ///@}
+
   const Real & temporalScale() const;
 
   /// Boltzmann's constant, k [J/K]
@@ -132,6 +157,26 @@ private:
 
   const Real _T_0;
 
+  /// Interface thickness, W
+  const Real _W;
+
+  /// Coefficient for capillary length coefficient, Eq. (37)
+  const Real _a_1;
+
+  ///@{
+  /// Conductivity and heat capacity of ice and air
+  const Real _k_i;
+  const Real _k_a;
+  const Real _c_i;
+  const Real _c_a;
+  ///@}
+
+  /// Diffusion coefficient of water vapor
+  const Real _D_v;
+
+  /// Spatial scaling
+  const Real _spatial_scale;
+
   /// Storage for pre-computing rho_vs at the reference temperature
   Real _rho_vs_T_0;
 
@@ -0,0 +1,80 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAFFT_H
+#define PIKAFFT_H
+
+// STL includes
+#include <complex>
+#include <vector>
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+/**
+ * A self-contained, threaded, radix-2 fast Fourier transform on a regular periodic grid.
+ *
+ * The data is stored with the x index varying fastest, i.e., (k * ny + j) * nx + i, and
+ * the transform is applied along each direction in turn. Each grid dimension must be a
+ * power of two (a dimension of one is ignored).
+ */
+class PikaFFT
+{
+public:
+
+  /**
+   * Class constructor
+   * @param n The number of grid points in each direction (x, y, z)
+   */
+  PikaFFT(const std::vector<unsigned int> & n);
+
+  /**
+   * Performs an in-place forward transform
+   * @param data The grid data to transform
+   */
+  void forward(std::vector<std::complex<libMesh::Real> > & data) const;
+
+  /**
+   * Performs an in-place inverse transform, including the 1/N normalization
+   * @param data The grid data to transform
+   */
+  void inverse(std::vector<std::complex<libMesh::Real> > & data) const;
+
+  /**
+   * Returns true if the supplied value is a power of two
+   */
+  static bool isPowerOfTwo(unsigned int n);
+
+private:
+
+  /**
+   * Transform all of the lines in the supplied direction
+   * @param data The grid data to transform
+   * @param dir The direction (0, 1, or 2)
+   * @param inverse True for an inverse transform
+   */
+  void transformDirection(std::vector<std::complex<libMesh::Real> > & data, unsigned int dir, bool inverse) const;
+
+  /**
+   * In-place iterative Cooley-Tukey transform of a single line
+   * @param line The line data, its size must be a power of two
+   * @param inverse True for an inverse transform (without normalization)
+   */
+  static void transformLine(std::vector<std::complex<libMesh::Real> > & line, bool inverse);
+
+  /// Number of grid points in each direction
+  std::vector<unsigned int> _n;
+
+  /// Total number of grid points
+  std::size_t _size;
+};
+
+#endif // PIKAFFT_H
@@ -0,0 +1,159 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKATIMERS_H
+#define PIKATIMERS_H
+
+// STL includes
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+
+// Forward declarations
+class MooseApp;
+
+/**
+ * Storage for the per-object timers and call counters of the Pika objects
+ *
+ * Each (object, section) pair is registered once, during object construction, and each thread
+ * accumulates into its own storage so that timing requires no locking. Timing is disabled until
+ * a PikaTimerReport object enables it, in which case the cost of a timed section is a single
+ * branch. One instance exists for each application, so MultiApps are reported separately; the
+ * instance is removed by the application destructor (see PikaApp::~PikaApp), so that a new
+ * application at the same address, e.g., a reset MultiApp, starts without timers.
+ */
+class PikaTimers
+{
+public:
+
+  /// Accumulated data for a single timed section on a single thread
+  struct Data
+  {
+    Data() : calls(0), seconds(0) {}
+    unsigned long calls;
+    Real seconds;
+  };
+
+  /**
+   * Returns the timers for the supplied application
+   */
+  static PikaTimers & get(const MooseApp & app);
+
+  /**
+   * Removes the timers of the supplied application, this must be called when it is destroyed
+   */
+  static void release(const MooseApp & app);
+
+  /**
+   * Registers a timed section, registering an existing pair returns the existing id
+   * @param object The name of the object
+   * @param section The name of the timed entry point (e.g., "computeResidual")
+   * @return The id of the section
+   */
+  unsigned int registerSection(const std::string & object, const std::string & section);
+
+  ///@{
+  /**
+   * Enable/disable timing
+   */
+  bool enabled() const { return _enabled; }
+  void enable(bool state) { _enabled = state; }
+  ///@}
+
+  /**
+   * Accumulates a call to a section
+   * @param tid The current thread
+   * @param id The section id returned by registerSection
+   * @param seconds The duration of the call
+   */
+  void add(THREAD_ID tid, unsigned int id, Real seconds)
+  {
+    Data & data = _data[tid][id];
+    data.calls++;
+    data.seconds += seconds;
+  }
+
+  /**
+   * Returns the data for each section, summed over the threads
+   */
+  std::vector<Data> totals() const;
+
+  ///@{
+  /**
+   * Returns the object and section names of a section
+   */
+  unsigned int numSections() const { return _objects.size(); }
+  const std::string & objectName(unsigned int id) const { return _objects[id]; }
+  const std::string & sectionName(unsigned int id) const { return _sections[id]; }
+  ///@}
+
+private:
+
+  PikaTimers();
+
+  /**
+   * Returns the timers of each application and the mutex guarding them
+   */
+  static std::map<const MooseApp *, PikaTimers> & instances();
+  static Threads::spin_mutex & mutex();
+
+  /// Flag indicating if timing is enabled
+  bool _enabled;
+
+  ///@{
+  /// The object and section names of each section
+  std::vector<std::string> _objects;
+  std::vector<std::string> _sections;
+  ///@}
+
+  /// Data for each thread and section
+  std::vector<std::vector<Data> > _data;
+};
+
+/**
+ * Times a scope, adding the elapsed time to the supplied section when timing is enabled
+ */
+class PikaScopedTimer
+{
+public:
+  PikaScopedTimer(PikaTimers & timers, unsigned int id, THREAD_ID tid) :
+      _timers(timers.enabled() ? &timers : NULL),
+      _id(id),
+      _tid(tid)
+  {
+    if (_timers)
+      _start = std::chrono::steady_clock::now();
+  }
+
+  ~PikaScopedTimer()
+  {
+    if (_timers)
+    {
+      std::chrono::duration<Real> elapsed = std::chrono::steady_clock::now() - _start;
+      _timers->add(_tid, _id, elapsed.count());
+    }
+  }
+
+private:
+  PikaTimers * _timers;
+  const unsigned int _id;
+  const THREAD_ID _tid;
+  std::chrono::steady_clock::time_point _start;
+};
+
+#endif // PIKATIMERS_H
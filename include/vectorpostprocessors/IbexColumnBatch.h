@@ -0,0 +1,185 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef IBEXCOLUMNBATCH_H
+#define IBEXCOLUMNBATCH_H
+
+// MOOSE includes
+#include "GeneralVectorPostprocessor.h"
+
+// Pika includes
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class IbexColumnBatch;
+class IbexMeteorologicalForcing;
+
+template<>
+InputParameters validParams<IbexColumnBatch>();
+
+/**
+ * Advances many independent 1D snowpack columns, the batched equivalent of
+ * problems/ibex/ibex_1d.i (HeatConduction, IbexShortwaveForcingFunction, IbexSurfaceFluxBC and
+ * IbexSnowMaterial), and reports the surface and mean temperature of each column.
+ *
+ * Each column is a uniform mesh of linear elements with a lumped mass, a fixed bottom
+ * temperature and the IbexSurfaceFluxBC energy balance, linearized about the previous surface
+ * temperature, at the top; a backward Euler step is one tridiagonal solve per column.
+ *
+ * The columns are divided among the processors. The state is stored as structure-of-arrays,
+ * node-major with the columns contiguous, so the tridiagonal sweeps vectorize across columns;
+ * the sweeps are threaded over blocks of columns.
+ *
+ * The per-column snow properties and forcing station are read from the optional 'columns' CSV
+ * file (see the parameter descriptions); the remaining columns use the parameter values.
+ */
+class IbexColumnBatch :
+  public GeneralVectorPostprocessor,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  IbexColumnBatch(const InputParameters & parameters);
+
+  ///@{
+  /**
+   * Advances the columns to the current time (execute) and gathers the results (finalize)
+   */
+  virtual void initialize(){}
+  virtual void execute();
+  virtual void finalize();
+  ///@}
+
+  /**
+   * Per column inputs, stored for the local columns
+   */
+  struct Columns
+  {
+    std::vector<unsigned int> forcing;
+    std::vector<Real> density;
+    std::vector<Real> conductivity;
+    std::vector<Real> bottom_temperature;
+    std::vector<Real> air_temperature_offset;
+    std::vector<Real> short_wave_factor;
+  };
+
+  /**
+   * Per step surface forcing of the local columns
+   */
+  struct Forcing
+  {
+    std::vector<Real> long_wave;
+    std::vector<Real> short_wave;
+    std::vector<Real> air_temperature;
+    std::vector<Real> relative_humidity;
+    std::vector<Real> atmospheric_pressure;
+    std::vector<Real> air_velocity;
+  };
+
+protected:
+
+  /**
+   * Advances all local columns by dt
+   */
+  void step(Real dt);
+
+  /**
+   * Surface energy balance of IbexSurfaceFluxBC and its temperature derivative
+   */
+  void surfaceFlux(Real T, std::size_t col, Real & flux, Real & dflux) const;
+
+  /// Total number of columns
+  unsigned int _num_columns;
+
+  /// Number of elements and nodes per column
+  const unsigned int _num_elements;
+  const unsigned int _num_nodes;
+
+  /// Column depth and element size
+  const Real _depth;
+  const Real _h;
+
+  /// The range of the columns owned by this processor
+  std::size_t _first;
+  std::size_t _num_local;
+
+  /// Number of columns per thread block
+  const unsigned int _block_size;
+
+  /// The forcing stations
+  std::vector<const IbexMeteorologicalForcing *> _stations;
+
+  ///@{
+  /// Values used for the channels not provided by a station
+  const Real _air_temperature;
+  const Real _relative_humidity;
+  const Real _atmospheric_pressure;
+  const Real _air_velocity;
+  const Real _long_wave;
+  const Real _short_wave;
+  ///@}
+
+  ///@{
+  /// Optical properties (see IbexShortwaveForcingFunction and IbexSurfaceFluxBC)
+  const Real _vis_albedo;
+  const Real _nir_albedo;
+  const Real _vis_extinction;
+  const Real _nir_extinction;
+  const Real _swir_albedo;
+  ///@}
+
+  ///@{
+  /// Surface energy balance constants (see IbexSurfaceFluxBC)
+  const Real _emissivity;
+  const Real _ratio_of_molecular_weights;
+  const Real _latent_heat;
+  const Real _water_vapor_transport;
+  const Real _transport_coefficient;
+  const Real _reference_temperature;
+  const Real _reference_vapor_pressure;
+  const Real _specific_heat_air;
+  ///@}
+
+  /// Local column inputs
+  Columns _columns;
+
+  /// Local column forcing for the current step
+  Forcing _forcing;
+
+  /// Temperature, node-major: _temperature[node * _num_local + column]
+  std::vector<Real> _temperature;
+
+  ///@{
+  /// Tridiagonal system storage, same layout as the temperature
+  std::vector<Real> _lower;
+  std::vector<Real> _diag;
+  std::vector<Real> _upper;
+  std::vector<Real> _rhs;
+  ///@}
+
+  ///@{
+  /// Output vectors
+  VectorPostprocessorValue & _column_vector;
+  VectorPostprocessorValue & _surface_temperature_vector;
+  VectorPostprocessorValue & _mean_temperature_vector;
+  ///@}
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  ///@}
+};
+
+#endif // IBEXCOLUMNBATCH_H
@@ -0,0 +1,126 @@
+/**********************************************************************************/
+/*                  Pika: Phase field snow micro-structure model                  */
+/*                                                                                */
+/*                     (C) 2014 Battelle Energy Alliance, LLC                     */
+/*                              ALL RIGHTS RESERVED                               */
+/*                                                                                */
+/*                   Prepared by Battelle Energy Alliance, LLC                    */
+/*                      Under Contract No. DE-AC07-05ID14517                      */
+/*                      With the U. S. Department of Energy                       */
+/**********************************************************************************/
+
+#ifndef PIKAMICROSTRUCTURESTATISTICS_H
+#define PIKAMICROSTRUCTURESTATISTICS_H
+
+// MOOSE includes
+#include "ElementVectorPostprocessor.h"
+
+// Pika includes
+#include "PropertyUserObjectInterface.h"
+#include "PikaTimerInterface.h"
+
+// Forward declarations
+class PikaMicrostructureStatistics;
+
+template<>
+InputParameters validParams<PikaMicrostructureStatistics>();
+
+/**
+ * Computes snow microstructure statistics in situ, so that full field output is not needed to
+ * track the evolution of the ice matrix.
+ *
+ * The interface is measured with the diffuse interface area density |grad(phi)|/2. The mean
+ * curvature (sum of the principal curvatures, positive for convex ice) is computed from
+ * first derivatives only, using the equilibrium profile phi = tanh(x/(sqrt(2)W)) and an
+ * integration by parts:
+ *
+ *   int kappa dA ~= -int phi*|grad(phi)| / (sqrt(2)W) dV
+ *
+ * The optional interface velocity (PikaInterfaceVelocity) and supersaturation
+ * (PikaSupersaturation) are averaged over the interface; the velocity is also binned into an
+ * area weighted histogram, values outside of the range are added to the end bins.
+ */
+class PikaMicrostructureStatistics :
+  public ElementVectorPostprocessor,
+  public PropertyUserObjectInterface,
+  public PikaTimerInterface
+{
+public:
+
+  /**
+   * Class constructor
+   * @param parameters The input parameters
+   */
+  PikaMicrostructureStatistics(const InputParameters & parameters);
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void finalize();
+  virtual void threadJoin(const UserObject & y);
+
+protected:
+
+  /// The phase-field variable
+  const VariableValue & _phase;
+
+  /// Gradient of the phase-field variable
+  const VariableGradient & _grad_phase;
+
+  /// True when the interface velocity is coupled
+  const bool _has_velocity;
+
+  /// The interface velocity
+  const VariableValue & _velocity;
+
+  /// True when the supersaturation is coupled
+  const bool _has_supersaturation;
+
+  /// The supersaturation
+  const VariableValue & _supersaturation;
+
+  /// The interface thickness, W
+  const Real & _W;
+
+  ///@{
+  /// Velocity histogram range and number of bins
+  const Real _velocity_min;
+  const Real _velocity_max;
+  const unsigned int _num_bins;
+  ///@}
+
+  ///@{
+  /// Local integrals, summed in threadJoin and finalize
+  Real _volume;
+  Real _ice_volume;
+  Real _area;
+  Real _profile_area;
+  Real _curvature;
+  Real _velocity_area;
+  Real _supersaturation_area;
+  std::vector<Real> _histogram;
+  ///@}
+
+  ///@{
+  /// Output vectors (one entry each)
+  VectorPostprocessorValue & _ice_volume_fraction_vector;
+  VectorPostprocessorValue & _interface_area_vector;
+  VectorPostprocessorValue & _specific_surface_area_vector;
+  VectorPostprocessorValue & _mean_curvature_vector;
+  VectorPostprocessorValue & _mean_velocity_vector;
+  VectorPostprocessorValue & _mean_supersaturation_vector;
+  ///@}
+
+  ///@{
+  /// Output velocity histogram (bin centers and fraction of the interface area)
+  VectorPostprocessorValue & _bin_center_vector;
+  VectorPostprocessorValue & _bin_area_fraction_vector;
+  ///@}
+
+  ///@{
+  /// Timers for the instrumented entry points
+  unsigned int _execute_timer;
+  unsigned int _finalize_timer;
+  ///@}
+};
+
+#endif // PIKAMICROSTRUCTURESTATISTICS_H
@@ -0,0 +1,101 @@
+# Periodic version of snow.i computed with the Fourier-spectral solver. The spectral grid
+# carries the solution and the coarse mesh is only used for sampling and output.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 64
+  ny = 64
+  xmax = .005
+  ymax = .005
+[]
+
+[AuxVariables]
+  [./T]
+  [../]
+  [./u]
+  [../]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ImageFunction
+    upper_value = -1
+    lower_value = 1
+    file = snow.png
+    threshold = 128
+  [../]
+  [./T_func]
+    type = ParsedFunction
+    value = 263.15
+  [../]
+[]
+
+[UserObjects]
+  [./spectral]
+    type = PikaSpectralSolver
+    resolution = '512 512'
+    phase_function = phi_func
+    temperature_function = T_func
+  [../]
+[]
+
+[AuxKernels]
+  [./T_aux]
+    type = PikaSpectralAux
+    variable = T
+    spectral_solver = spectral
+    field = temperature
+    execute_on = 'initial timestep_end'
+  [../]
+  [./u_aux]
+    type = PikaSpectralAux
+    variable = u
+    spectral_solver = spectral
+    field = chemical_potential
+    execute_on = 'initial timestep_end'
+  [../]
+  [./phi_aux]
+    type = PikaSpectralAux
+    variable = phi
+    spectral_solver = spectral
+    field = phase
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = T
+  phase = phi
+  interface_thickness = 1e-5
+  temporal_scaling = 1e-4
+  condensation_coefficient = .01
+[]
+
+[Postprocessors]
+  [./ice_fraction]
+    type = ElementAverageValue
+    variable = phi
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 20000
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+  [./exodus]
+    type = Exodus
+    interval = 100
+  [../]
+[]
@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Compares the postprocessor CSV files written by two runs of the same problem, e.g. a parallel,
+# batched, or parallel-in-time run against a serial reference. Both files are written by the
+# test itself, so the comparison fails if either is missing or the rows do not match in time.
+#
+# Usage: python compareCSV.py reference.csv result.csv [--columns a b ...] [--rel_tol 1e-6]
+#                             [--abs_zero 1e-10] [--common_times] [--fewer name]
+from __future__ import print_function
+import sys, csv, argparse
+
+##
+# Reads a postprocessor CSV file
+# @param filename The file to read
+# @return A list of dictionaries of the values in each row
+def read(filename):
+  with open(filename) as f:
+    return [dict((key, float(value)) for key, value in row.items()) for row in csv.DictReader(f)]
+
+##
+# Compares the columns of two postprocessor CSV files
+# @param reference_file The CSV file of the reference run
+# @param result_file The CSV file of the compared run
+# @param columns The columns to compare, all columns of the reference if empty
+# @param rel_tol The allowed difference relative to the reference value
+# @param abs_zero Values with a magnitude below this are treated as zero
+# @param times Compare the time column, otherwise only the rows at common times are compared
+# @param fewer A column (e.g., iterations) whose sum must be smaller for the result, it is not compared
+# @return An error message, None if the files match
+def compare(reference_file, result_file, columns=None, rel_tol=1e-6, abs_zero=1e-10, times=True, fewer=None):
+  try:
+    reference = read(reference_file)
+    result = read(result_file)
+  except IOError as e:
+    return str(e)
+
+  if not reference:
+    return '{} is empty'.format(reference_file)
+  columns = columns or [name for name in reference[0].keys() if name not in ['time', fewer]]
+  for name in columns + ([fewer] if fewer else []):
+    for filename, rows in [(reference_file, reference), (result_file, result)]:
+      if rows and name not in rows[0]:
+        return 'The column {} is missing from {}'.format(name, filename)
+
+  if times:
+    if len(reference) != len(result):
+      return 'The number of rows differs: {} in {} and {} in {}'.format(len(reference), reference_file, len(result), result_file)
+    pairs = list(zip(reference, result))
+  else:
+    rows = dict((round(row['time'], 8), row) for row in result)
+    pairs = [(row, rows[round(row['time'], 8)]) for row in reference if round(row['time'], 8) in rows]
+    if not pairs:
+      return 'No common times in {} and {}'.format(reference_file, result_file)
+
+  for ref, res in pairs:
+    if abs(ref['time'] - res['time']) > 1e-8 * max(1.0, abs(ref['time'])):
+      return 'The times differ: {} and {}'.format(ref['time'], res['time'])
+    for name in columns:
+      a, b = ref[name], res[name]
+      if abs(a) < abs_zero and abs(b) < abs_zero:
+        continue
+      if abs(a - b) > rel_tol * max(abs(a), abs(b)):
+        return 'The {} at time {} differs: {} in {} and {} in {}'.format(name, ref['time'], a, reference_file, b, result_file)
+
+  print('{} rows of {} match'.format(len(pairs), ', '.join(sorted(columns))))
+
+  if fewer:
+    ref_total = sum(row[fewer] for row in reference)
+    res_total = sum(row[fewer] for row in result)
+    print('Total {}: {:g} in {} and {:g} in {}'.format(fewer, ref_total, reference_file, res_total, result_file))
+    if res_total >= ref_total:
+      return 'The total {} was not reduced'.format(fewer)
+  return None
+
+if __name__ == '__main__':
+  parser = argparse.ArgumentParser(description='Compares the postprocessor CSV files of two runs')
+  parser.add_argument('reference', help='The CSV file of the reference run')
+  parser.add_argument('result', help='The CSV file of the compared run')
+  parser.add_argument('--columns', nargs='+', help='The columns to compare, by default all of the reference columns')
+  parser.add_argument('--rel_tol', type=float, default=1e-6, help='The allowed relative difference')
+  parser.add_argument('--abs_zero', type=float, default=1e-10, help='Values with a smaller magnitude are treated as zero')
+  parser.add_argument('--common_times', action='store_true', help='Only compare the rows at times present in both files')
+  parser.add_argument('--fewer', help='A column whose sum must be smaller in the result than in the reference')
+  args = parser.parse_args()
+
+  error = compare(args.reference, args.result, args.columns, args.rel_tol, args.abs_zero, not args.common_times, args.fewer)
+  if error:
+    sys.exit(error)
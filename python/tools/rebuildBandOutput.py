@@ -0,0 +1,192 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+##
+# Rebuilds the full nodal fields from the files written by the PikaBandOutput object.
+#
+# Each processor writes <file_base>_<full|band>_<output>.<processor>.bin[.gz] containing, in the
+# native byte order:
+#
+#   char[8]   'PIKABAND'
+#   uint32    version (1)
+#   uint8     kind (0 = full, 1 = band)
+#   uint8     bytes per value (4 or 8)
+#   float64   time
+#   int32     time step
+#   uint32    number of variables, followed by (uint32 length, chars) for each name
+#   uint64    number of nodes, followed by the uint64 node ids
+#   float64   x, y, z of each node (full files only)
+#   for each variable:
+#     value of each node (float32 or float64)
+#     count, min, max, mean (float64) of the bulk air nodes, then of the bulk ice nodes
+#
+# The first variable is always the phase. The fields of an output are rebuilt from the latest
+# full checkpoint and the band values of that output; with --shift-bulk the bulk air and ice
+# values are shifted by the change in their means since the checkpoint.
+from __future__ import print_function
+import os, re, sys, glob, gzip, struct, argparse
+
+##
+# Reads a single file, returning a dict with the header, ids, coordinates, values and summaries
+def readFile(filename):
+  opener = gzip.open if filename.endswith('.gz') else open
+  with opener(filename, 'rb') as f:
+    data = f.read()
+
+  pos = [0]
+  def read(fmt, count=1):
+    size = struct.calcsize(fmt) * count
+    out = struct.unpack('=' + fmt * count, data[pos[0]:pos[0] + size])
+    pos[0] += size
+    return out if count > 1 else out[0]
+
+  if data[0:8] != b'PIKABAND':
+    raise IOError('{} is not a PikaBandOutput file'.format(filename))
+  pos[0] = 8
+  result = dict()
+  result['version'] = read('I')
+  result['full'] = read('B') == 0
+  fmt = 'f' if read('B') == 4 else 'd'
+  result['time'] = read('d')
+  result['step'] = read('i')
+
+  names = []
+  for i in range(read('I')):
+    length = read('I')
+    names.append(data[pos[0]:pos[0] + length].decode())
+    pos[0] += length
+  result['names'] = names
+
+  n = read('Q')
+  ids = list(read('Q', n)) if n > 1 else ([read('Q')] if n == 1 else [])
+  result['ids'] = ids
+
+  coords = dict()
+  if result['full']:
+    for node in ids:
+      coords[node] = read('d', 3)
+  result['coords'] = coords
+
+  values = dict()
+  summaries = dict()
+  for name in names:
+    v = read(fmt, n) if n > 1 else ((read(fmt),) if n == 1 else ())
+    values[name] = dict(zip(ids, v))
+    summaries[name] = [read('d', 4), read('d', 4)]
+  result['values'] = values
+  result['summaries'] = summaries
+  return result
+
+##
+# Reads and combines the files of all processors for an output
+def readOutput(file_base, kind, number):
+  files = sorted(glob.glob('{}_{}_{}.*.bin*'.format(file_base, kind, number)))
+  if not files:
+    return None
+
+  combined = None
+  for filename in files:
+    part = readFile(filename)
+    if combined is None:
+      combined = part
+      continue
+    combined['coords'].update(part['coords'])
+    for name in combined['names']:
+      combined['values'][name].update(part['values'][name])
+      combined['summaries'][name] = combineSummaries(combined['summaries'][name], part['summaries'][name])
+  return combined
+
+##
+# Combines the (count, min, max, mean) summaries of two processors
+def combineSummaries(a, b):
+  out = []
+  for x, y in zip(a, b):
+    count = x[0] + y[0]
+    if count == 0:
+      out.append(x)
+    else:
+      out.append((count, min(x[1], y[1]) if x[0] else y[1], max(x[2], y[2]) if x[0] else y[2],
+                  (x[0] * x[3] + y[0] * y[3]) / count))
+  return out
+
+##
+# Returns the output numbers of the given kind
+def outputNumbers(file_base, kind):
+  pattern = re.compile(r'{}_{}_(\d+)\.\d+\.bin'.format(re.escape(os.path.basename(file_base)), kind))
+  numbers = set()
+  for filename in glob.glob('{}_{}_*.bin*'.format(file_base, kind)):
+    match = pattern.match(os.path.basename(filename))
+    if match:
+      numbers.add(match.group(1))
+  return sorted(numbers, key=int)
+
+##
+# Rebuilds the full fields for an output number
+def rebuild(file_base, number, shift_bulk=False):
+  fulls = [n for n in outputNumbers(file_base, 'full') if int(n) <= int(number)]
+  if not fulls:
+    raise IOError('No full checkpoint precedes output {}'.format(number))
+  full = readOutput(file_base, 'full', fulls[-1])
+  if fulls[-1] == number:
+    return full
+
+  band = readOutput(file_base, 'band', number)
+  if band is None:
+    raise IOError('Output {} does not exist'.format(number))
+
+  phase = full['names'][0]
+  bulk_phase = dict((node, int(v > 0)) for node, v in full['values'][phase].items())
+  for name in full['names']:
+    values = full['values'][name]
+    if shift_bulk:
+      shift = [band['summaries'][name][i][3] - full['summaries'][name][i][3] for i in range(2)]
+      for node in values:
+        if node not in band['values'][name]:
+          values[node] += shift[bulk_phase[node]]
+    values.update(band['values'][name])
+    full['summaries'][name] = band['summaries'][name]
+
+  full['time'] = band['time']
+  full['step'] = band['step']
+  full['full'] = False
+  return full
+
+##
+# Writes the rebuilt fields as CSV: id, x, y, z, variables...
+def writeCSV(result, filename):
+  names = result['names']
+  with open(filename, 'w') as f:
+    f.write(','.join(['id', 'x', 'y', 'z'] + names) + '\n')
+    for node in sorted(result['coords']):
+      row = [str(node)] + ['{:.10g}'.format(c) for c in result['coords'][node]]
+      row += ['{:.10g}'.format(result['values'][name][node]) for name in names]
+      f.write(','.join(row) + '\n')
+
+if __name__ == '__main__':
+  parser = argparse.ArgumentParser(description='Rebuilds full nodal fields from PikaBandOutput files.')
+  parser.add_argument('file_base', help='The file base of the PikaBandOutput object')
+  parser.add_argument('outputs', nargs='*', help='The output numbers to rebuild (default: all)')
+  parser.add_argument('--shift-bulk', action='store_true', help='Shift the bulk values by the change in their means since the checkpoint')
+  parser.add_argument('--output', default=None, help='CSV file base, defaults to <file_base>_rebuilt')
+  args = parser.parse_args()
+
+  available = sorted(set(outputNumbers(args.file_base, 'full') + outputNumbers(args.file_base, 'band')), key=int)
+  outputs = [n for n in available if not args.outputs or int(n) in [int(o) for o in args.outputs]]
+  if not outputs:
+    sys.exit('No PikaBandOutput files found for {}'.format(args.file_base))
+
+  base = args.output or args.file_base + '_rebuilt'
+  for number in outputs:
+    result = rebuild(args.file_base, number, args.shift_bulk)
+    filename = '{}_{}.csv'.format(base, number)
+    writeCSV(result, filename)
+    print('{}: time = {:g}, {} nodes'.format(filename, result['time'], len(result['coords'])))
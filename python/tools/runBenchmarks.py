@@ -0,0 +1,176 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+from __future__ import print_function
+import os, sys, re, json, time, shutil, tempfile, argparse, subprocess
+
+PIKA_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+
+##
+# Micro-benchmarks: (name, base input in benchmarks/micro, command line arguments adding the object)
+# Each run uses the PikaBenchmark executioner, which writes the residual/Jacobian timings as JSON;
+# the materials are timed through a MaterialRealAux, without any Kernel (material.i).
+MICRO = [
+  ('PropertyUserObject', 'pika.i', ['Executioner/property_evaluations=1000000', 'Executioner/residual_evaluations=0', 'Executioner/jacobian_evaluations=0']),
+  ('PikaMaterial', 'material.i', []),
+  ('PikaDiffusion', 'pika.i', ['Kernels/bench/type=PikaDiffusion', 'Kernels/bench/variable=T', 'Kernels/bench/coefficient=1']),
+  ('PikaTimeDerivative', 'pika.i', ['Kernels/bench/type=PikaTimeDerivative', 'Kernels/bench/variable=T', 'Kernels/bench/coefficient=1']),
+  ('PikaCoupledTimeDerivative', 'pika.i', ['Kernels/bench/type=PikaCoupledTimeDerivative', 'Kernels/bench/variable=u', 'Kernels/bench/coupled_variable=phi', 'Kernels/bench/coefficient=0.5']),
+  ('PhaseTransition', 'pika.i', ['Kernels/bench/type=PhaseTransition', 'Kernels/bench/variable=phi', 'Kernels/bench/chemical_potential=u', 'Kernels/bench/mob_name=mobility', 'Kernels/bench/lambda=phase_field_coupling_constant', 'Kernels/bench/coefficient=1']),
+  ('AntiTrapping', 'pika.i', ['Kernels/bench/type=AntiTrapping', 'Kernels/bench/variable=u', 'Kernels/bench/phase=phi']),
+  ('PikaChemicalPotentialBC', 'pika.i', ['BCs/bench/type=PikaChemicalPotentialBC', 'BCs/bench/variable=u', 'BCs/bench/boundary=top', 'BCs/bench/temperature=T', 'BCs/bench/phase_variable=phi']),
+  ('IbexShortwaveForcingFunction', 'ibex.i', ['Kernels/bench/type=IbexShortwaveForcingFunction', 'Kernels/bench/variable=T', 'Kernels/bench/short_wave=shortwave']),
+  ('IbexSurfaceFluxBC', 'ibex.i', ['BCs/bench/type=IbexSurfaceFluxBC', 'BCs/bench/variable=T', 'BCs/bench/boundary=top', 'BCs/bench/long_wave=235', 'BCs/bench/short_wave=shortwave']),
+]
+
+##
+# Problem benchmarks: (name, directory, [(input, arguments), ...])
+# The stages are run in order in a copy of the directory, the final stage is the timed problem
+# and the earlier stages create the initial conditions it reads.
+PROBLEMS = [
+  ('snow_2d', 'problems/snow_2d', [('phi_initial.i', []),
+                                   ('snow.i', ['Executioner/num_steps=5', 'Adaptivity/max_h_level=5', 'Outputs/exodus=false'])]),
+  ('bubble_2d', 'problems/bubble_2d', [('phi_initial_1e5.i', []),
+                                       ('full_543_1e5.i', ['Executioner/num_steps=5', 'Outputs/exodus=false'])]),
+  ('yeti', 'problems/yeti', [('phi_initial.i', []),
+                             ('yeti.i', ['Executioner/num_steps=3', 'Mesh/uniform_refine=3', 'Adaptivity/max_h_level=3',
+                                         'MultiApps/micro/positions=0.1 0.1 0', 'Outputs/exodus=false'])]),
+  ('snow_3d', 'benchmarks/problems', [('snow_3d.i', [])]),
+]
+
+##
+# Run a command, returning the wall time [s] and peak resident set size [kB] of the process tree
+def run(cmd, cwd, log):
+  start = time.time()
+  proc = subprocess.Popen(cmd, cwd=cwd, stdout=log, stderr=subprocess.STDOUT)
+  pid, status, usage = os.wait4(proc.pid, 0)
+  wall = time.time() - start
+
+  # ru_maxrss is in kilobytes on Linux and bytes on macOS
+  rss = usage.ru_maxrss / 1024 if sys.platform == 'darwin' else usage.ru_maxrss
+  return os.WEXITSTATUS(status), wall, rss
+
+##
+# Build the command for running the application
+def command(opt, input_file, args):
+  cmd = [opt.executable, '-i', input_file, '--no-color'] + args
+  if opt.threads > 1:
+    cmd.append('--n-threads=' + str(opt.threads))
+  if opt.mpi > 1:
+    cmd = ['mpiexec', '-n', str(opt.mpi)] + cmd
+  return cmd
+
+def runMicro(opt, work):
+  results = []
+  for name, base, args in MICRO:
+    if not re.search(opt.re, name):
+      continue
+    json_file = os.path.join(work, name + '_benchmark.json')
+    cmd = command(opt, os.path.join(PIKA_DIR, 'benchmarks', 'micro', base),
+                  args + ['Outputs/file_base=' + os.path.join(work, name), 'Executioner/benchmark_file=' + json_file])
+    with open(os.path.join(work, name + '.log'), 'w') as log:
+      code, wall, rss = run(cmd, work, log)
+
+    entry = {'name' : name, 'layer' : 'micro', 'returncode' : code, 'wall_seconds' : wall, 'peak_memory_kb' : rss}
+    if code == 0 and os.path.exists(json_file):
+      with open(json_file) as fid:
+        entry.update(json.load(fid))
+    results.append(entry)
+    print('{:<32} {:>10.3f} s {:>10d} kB {}'.format(name, wall, rss, 'OK' if code == 0 else 'FAILED'))
+  return results
+
+def runProblems(opt, work):
+  results = []
+  for name, directory, stages in PROBLEMS:
+    if not re.search(opt.re, name):
+      continue
+    cwd = os.path.join(work, name)
+    shutil.copytree(os.path.join(PIKA_DIR, directory), cwd)
+
+    entry = {'name' : name, 'layer' : 'problems', 'stages' : []}
+    code = 0
+    with open(os.path.join(work, name + '.log'), 'w') as log:
+      for input_file, args in stages:
+        code, wall, rss = run(command(opt, input_file, args), cwd, log)
+        entry['stages'].append({'input' : input_file, 'returncode' : code, 'wall_seconds' : wall, 'peak_memory_kb' : rss})
+        if code != 0:
+          break
+
+    # The final stage is the benchmark, the others create its initial conditions
+    final = entry['stages'][-1]
+    entry.update({'returncode' : code, 'wall_seconds' : final['wall_seconds'], 'peak_memory_kb' : final['peak_memory_kb']})
+    results.append(entry)
+    print('{:<32} {:>10.3f} s {:>10d} kB {}'.format(name, final['wall_seconds'], final['peak_memory_kb'], 'OK' if code == 0 else 'FAILED'))
+  return results
+
+##
+# Print the ratio of the current to the previous results for each benchmark
+def compare(results, filename):
+  with open(filename) as fid:
+    previous = dict((r['name'], r) for r in json.load(fid)['benchmarks'])
+
+  print('\nComparison with ' + filename + ' (current / previous)')
+  for r in results:
+    old = previous.get(r['name'])
+    if old is None or not old.get('wall_seconds'):
+      continue
+    line = '{:<32} time {:>6.2f}'.format(r['name'], r['wall_seconds'] / old['wall_seconds'])
+    for key in ['residual_seconds', 'jacobian_seconds', 'property_seconds', 'aux_seconds']:
+      if old.get(key) and r.get(key) is not None:
+        line += '  {} {:>6.2f}'.format(key.split('_')[0], r[key] / old[key])
+    if old.get('peak_memory_kb'):
+      line += '  memory {:>6.2f}'.format(float(r['peak_memory_kb']) / old['peak_memory_kb'])
+    print(line)
+
+def gitRevision():
+  try:
+    return subprocess.check_output(['git', 'rev-parse', 'HEAD'], cwd=PIKA_DIR).decode().strip()
+  except (OSError, subprocess.CalledProcessError):
+    return None
+
+def main():
+  parser = argparse.ArgumentParser(description='Run the Pika performance benchmarks and write the results as JSON.')
+  parser.add_argument('--executable', default=os.path.join(PIKA_DIR, 'pika-opt'), help='The Pika executable to benchmark')
+  parser.add_argument('--layer', choices=['micro', 'problems', 'all'], default='all', help='The benchmarks to run')
+  parser.add_argument('--re', default='.*', help='Only run benchmarks with names matching this regular expression')
+  parser.add_argument('--mpi', type=int, default=1, help='The number of MPI processes')
+  parser.add_argument('--threads', type=int, default=1, help='The number of threads')
+  parser.add_argument('--output', default='benchmark_results.json', help='The JSON file to write')
+  parser.add_argument('--compare', help='A previous JSON results file to compare against')
+  parser.add_argument('--keep', action='store_true', help='Keep the working directory containing the logs and output')
+  opt = parser.parse_args()
+
+  work = tempfile.mkdtemp(prefix='pika_benchmark_')
+  results = []
+  if opt.layer in ['micro', 'all']:
+    results += runMicro(opt, work)
+  if opt.layer in ['problems', 'all']:
+    results += runProblems(opt, work)
+
+  data = {'revision' : gitRevision(), 'date' : time.strftime('%Y-%m-%dT%H:%M:%S'),
+          'executable' : opt.executable, 'mpi' : opt.mpi, 'threads' : opt.threads, 'benchmarks' : results}
+  with open(opt.output, 'w') as fid:
+    json.dump(data, fid, indent=2, sort_keys=True)
+  print('\nResults written to ' + opt.output)
+
+  if opt.compare:
+    compare(results, opt.compare)
+
+  if opt.keep:
+    print('Logs and output retained in ' + work)
+  else:
+    shutil.rmtree(work)
+
+  return 1 if any(r['returncode'] != 0 for r in results) else 0
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,117 @@
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+import os, csv
+from RunApp import RunApp
+
+##
+# A RunApp tester that also checks performance expectations
+#
+# The solver statistics, the total wall time, and the peak memory are collected by postprocessors
+# that are added from the command line and written to '<test name>_perf.csv' in the test
+# directory. Each limit that is set in the test specification is compared against these values:
+#
+#   max_nonlinear_iterations   Total nonlinear iterations over all timesteps
+#   max_linear_iterations      Total linear iterations over all timesteps
+#   max_residual_evaluations   Total residual evaluations over all timesteps
+#   max_wall_time              Wall time of the complete run [s], scaled by (1 + wall_time_tolerance)
+#   max_memory                 Peak resident set size of any process [MB], scaled by (1 + memory_tolerance)
+#
+# Exceeded limits fail the test, or with 'perf_failure = false' are reported as caveats so that
+# the test passes with a warning.
+class PerfRunApp(RunApp):
+
+  @staticmethod
+  def validParams():
+    params = RunApp.validParams()
+    params.addParam('max_nonlinear_iterations', "Maximum total number of nonlinear iterations")
+    params.addParam('max_linear_iterations', "Maximum total number of linear iterations")
+    params.addParam('max_residual_evaluations', "Maximum total number of residual evaluations")
+    params.addParam('max_wall_time', "Maximum wall time of the simulation [s]")
+    params.addParam('wall_time_tolerance', 0.25, "Relative tolerance applied to 'max_wall_time'")
+    params.addParam('max_memory', "Maximum peak resident set size of a process [MB]")
+    params.addParam('memory_tolerance', 0.1, "Relative tolerance applied to 'max_memory'")
+    params.addParam('perf_failure', True, "When false, exceeded limits are reported as warnings rather than failures")
+    return params
+
+  # Postprocessors added to the simulation: (name, csv reduction, command line arguments)
+  POSTPROCESSORS = [
+    ('nonlinear_iterations', sum, ['type=NumNonlinearIterations']),
+    ('linear_iterations', sum, ['type=NumLinearIterations']),
+    ('residual_evaluations', sum, ['type=NumResidualEvaluations']),
+    ('wall_time', max, ['type=PerfGraphData', 'section_name=Root', 'data_type=TOTAL']),
+    ('memory', max, ['type=MemoryUsage', 'mem_type=physical_memory', 'value_type=max_process', 'mem_units=megabytes', 'report_peak_value=true']),
+  ]
+
+  # Map of the limit parameters to the postprocessors and the parameter containing the tolerance
+  LIMITS = [
+    ('max_nonlinear_iterations', 'nonlinear_iterations', None),
+    ('max_linear_iterations', 'linear_iterations', None),
+    ('max_residual_evaluations', 'residual_evaluations', None),
+    ('max_wall_time', 'wall_time', 'wall_time_tolerance'),
+    ('max_memory', 'memory', 'memory_tolerance'),
+  ]
+
+  def __init__(self, name, params):
+    RunApp.__init__(self, name, params)
+
+    self.perf_file_base = self.specs['test_name'].replace('/', '_').replace('.', '_') + '_perf'
+    args = []
+    for pp, reduction, pp_args in self.POSTPROCESSORS:
+      args += ['Postprocessors/_perf_' + pp + '/' + a for a in pp_args]
+      args.append('Postprocessors/_perf_' + pp + '/outputs=_perf_csv')
+    args += ['Outputs/_perf_csv/type=CSV', 'Outputs/_perf_csv/file_base=' + self.perf_file_base]
+    self.specs['cli_args'] = list(self.specs['cli_args']) + args
+
+  def readPerformance(self):
+    filename = os.path.join(self.getTestDir(), self.perf_file_base + '.csv')
+    if not os.path.exists(filename):
+      return None
+
+    with open(filename) as fid:
+      rows = list(csv.DictReader(fid))
+
+    values = dict()
+    for pp, reduction, pp_args in self.POSTPROCESSORS:
+      column = '_perf_' + pp
+      data = [float(row[column]) for row in rows if row.get(column)]
+      if data:
+        values[pp] = reduction(data)
+    return values
+
+  def processResults(self, moose_dir, options, output):
+    output = RunApp.processResults(self, moose_dir, options, output)
+    if self.isFail():
+      return output
+
+    values = self.readPerformance()
+    if values is None:
+      self.setStatus(self.fail, 'MISSING PERF CSV')
+      return output
+
+    exceeded = []
+    for param, pp, tol_param in self.LIMITS:
+      if self.specs.isValid(param) and pp in values:
+        limit = float(self.specs[param])
+        if tol_param is not None:
+          limit *= 1 + float(self.specs[tol_param])
+        output += '\nPerformance %s: %g (limit %g)' % (pp, values[pp], limit)
+        if values[pp] > limit:
+          exceeded.append(pp.upper().replace('_', ' '))
+
+    if exceeded:
+      output += '\nPerformance limits exceeded: ' + ', '.join(exceeded) + '\n'
+      if self.specs['perf_failure']:
+        self.setStatus(self.fail, 'PERF: ' + ', '.join(exceeded))
+      else:
+        self.addCaveats('PERF WARNING: ' + ', '.join(exceeded))
+
+    return output
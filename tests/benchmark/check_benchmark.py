@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Checks the JSON file written by the PikaBenchmark executioner: all entries are present, the
+# evaluation counts and problem size match the run, and each requested measurement took time.
+# Usage: python check_benchmark.py <file> <n_processors> <n_elements> key=evaluations ...
+from __future__ import print_function
+import sys, json
+
+KEYS = ['n_processors', 'n_threads', 'n_dofs', 'n_elements', 'peak_memory_kb',
+        'property_evaluations', 'property_seconds', 'residual_evaluations', 'residual_seconds',
+        'jacobian_evaluations', 'jacobian_seconds', 'aux_evaluations', 'aux_seconds']
+
+def check(filename, n_processors, n_elements, evaluations):
+  try:
+    with open(filename) as f:
+      data = json.load(f)
+  except (IOError, ValueError) as e:
+    return 'Unable to read {}: {}'.format(filename, e)
+
+  missing = [key for key in KEYS if key not in data]
+  if missing:
+    return 'Missing entries: {}'.format(', '.join(missing))
+  if data['n_processors'] != n_processors:
+    return 'n_processors is {}, expected {}'.format(data['n_processors'], n_processors)
+  if data['n_elements'] != n_elements:
+    return 'n_elements is {}, expected {}'.format(data['n_elements'], n_elements)
+  if data['peak_memory_kb'] <= 0:
+    return 'The peak memory is not positive'
+
+  for name in ['property', 'residual', 'jacobian', 'aux']:
+    count = evaluations.get(name, 0)
+    if data[name + '_evaluations'] != count:
+      return '{}_evaluations is {}, expected {}'.format(name, data[name + '_evaluations'], count)
+    seconds = data[name + '_seconds']
+    if seconds < 0 or (count > 0) != (seconds > 0):
+      return '{}_seconds is {} for {} evaluations'.format(name, seconds, count)
+  print('{} is complete'.format(filename))
+  return None
+
+if __name__ == '__main__':
+  counts = dict((arg.split('=')[0], int(arg.split('=')[1])) for arg in sys.argv[4:])
+  error = check(sys.argv[1], int(sys.argv[2]), int(sys.argv[3]), counts)
+  if error:
+    sys.exit(error)
@@ -0,0 +1,73 @@
+# Parameter ensemble run in a single process: one TransientMultiApp sub-application per member,
+# all at the origin, with the varied parameters given per member in 'cli_args' (one entry per
+# member, the arguments separated by ';'). MOOSE distributes the members over the processors and
+# appends the member index to the output file base (ensemble_out_members0.csv, ...). The initial
+# microstructure is computed once by this application and sent to the members with a
+# MultiAppCopyTransfer; each member still builds its own mesh and equation systems.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 16
+  ny = 16
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  # The initial microstructure shared by the members
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.00025-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*5e-5))'
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+[]
+
+[MultiApps]
+  # Four members varying the condensation coefficient and temporal scaling
+  [./members]
+    type = TransientMultiApp
+    input_files = member.i
+    positions = '0 0 0  0 0 0  0 0 0  0 0 0'
+    cli_args = 'PikaMaterials/condensation_coefficient=0.01;PikaMaterials/temporal_scaling=1e-4
+                PikaMaterials/condensation_coefficient=0.1;PikaMaterials/temporal_scaling=1e-4
+                PikaMaterials/condensation_coefficient=0.01;PikaMaterials/temporal_scaling=1e-3
+                PikaMaterials/condensation_coefficient=0.1;PikaMaterials/temporal_scaling=1e-3'
+  [../]
+[]
+
+[Transfers]
+  [./initial_phase]
+    type = MultiAppCopyTransfer
+    direction = to_multiapp
+    multi_app = members
+    source_variable = phi
+    variable = phi
+    execute_on = initial
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1e-3
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,66 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 16
+  ny = 16
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[Variables]
+  # The initial condition is sent by the ensemble master
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  # The initial microstructure of ensemble.i, used by the reference runs of a single member
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.00025-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*5e-5))'
+  [../]
+[]
+
+[Kernels]
+  [./phase_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phase_diffusion]
+    type = PikaDiffusion
+    variable = phi
+    property = interface_thickness_squared
+  [../]
+  [./phase_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = 263.15
+  interface_thickness = 5e-5
+  phase = phi
+  temporal_scaling = 1e-04
+  condensation_coefficient = .01
+[]
+
+[Postprocessors]
+  [./ice_fraction]
+    type = ElementAverageValue
+    variable = phi
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1e-3
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+[]
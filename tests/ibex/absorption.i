@@ -0,0 +1,251 @@
+# Steady conduction with unit conductivity balancing the absorbed short-wave, so that the vertical
+# gradient of each temperature is the element average of the net short-wave flux below the surface
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 400
+  xmax = 0.001
+  ymax = 0.4
+[]
+
+[Variables]
+  [./T_default]
+  [../]
+  [./T_bands]
+  [../]
+  [./T_layers]
+  [../]
+[]
+
+[AuxVariables]
+  [./flux_default]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./flux_bands]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./flux_layers]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Functions]
+  [./short_wave]
+    type = ParsedFunction
+    value = 800
+  [../]
+[]
+
+[Kernels]
+  [./default_diffusion]
+    type = HeatConduction
+    variable = T_default
+  [../]
+  [./default_shortwave]
+    # VIS and NIR bands in a single layer, as before the bands were added
+    type = IbexShortwaveForcingFunction
+    variable = T_default
+    short_wave = short_wave
+  [../]
+  [./bands_diffusion]
+    type = HeatConduction
+    variable = T_bands
+  [../]
+  [./bands_shortwave]
+    # The default bands and optical properties given explicitly
+    type = IbexShortwaveForcingFunction
+    variable = T_bands
+    short_wave = short_wave
+    depth = depth
+    band_fractions = '0.545 0.274'
+    band_albedos = '0.94 0.80'
+    extinction = '40 110'
+  [../]
+  [./layers_diffusion]
+    type = HeatConduction
+    variable = T_layers
+  [../]
+  [./layers_shortwave]
+    # Three bands absorbed through a 5 cm surface layer, as in depth.i
+    type = IbexShortwaveForcingFunction
+    variable = T_layers
+    short_wave = short_wave
+    depth = depth
+    band_fractions = '0.4 0.3 0.1'
+    band_albedos = '0.95 0.85 0.6'
+    layer_depths = 0.05
+    extinction = '30 40 90 110 300 400'
+  [../]
+[]
+
+[AuxKernels]
+  [./flux_default]
+    type = VariableGradientComponent
+    variable = flux_default
+    gradient_variable = T_default
+    component = y
+  [../]
+  [./flux_bands]
+    type = VariableGradientComponent
+    variable = flux_bands
+    gradient_variable = T_bands
+    component = y
+  [../]
+  [./flux_layers]
+    type = VariableGradientComponent
+    variable = flux_layers
+    gradient_variable = T_layers
+    component = y
+  [../]
+[]
+
+[BCs]
+  [./default_bottom]
+    type = DirichletBC
+    variable = T_default
+    boundary = bottom
+    value = 0
+  [../]
+  [./bands_bottom]
+    type = DirichletBC
+    variable = T_bands
+    boundary = bottom
+    value = 0
+  [../]
+  [./layers_bottom]
+    type = DirichletBC
+    variable = T_layers
+    boundary = bottom
+    value = 0
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T_default
+    thermal_conductivity = 1
+  [../]
+[]
+
+[UserObjects]
+  [./depth]
+    type = IbexSnowDepth
+    surface = top
+  [../]
+[]
+
+[Postprocessors]
+  [./default_surface]
+    # Element centered 0.5 mm below the surface
+    type = PointValue
+    variable = flux_default
+    point = '0.0005 0.3995 0'
+  [../]
+  [./default_10mm]
+    # Element centered 10.5 mm below the surface
+    type = PointValue
+    variable = flux_default
+    point = '0.0005 0.3895 0'
+  [../]
+  [./default_above_layer]
+    # Element centered 49.5 mm below the surface
+    type = PointValue
+    variable = flux_default
+    point = '0.0005 0.3505 0'
+  [../]
+  [./default_below_layer]
+    # Element centered 50.5 mm below the surface
+    type = PointValue
+    variable = flux_default
+    point = '0.0005 0.3495 0'
+  [../]
+  [./default_deep]
+    # Element centered 200.5 mm below the surface
+    type = PointValue
+    variable = flux_default
+    point = '0.0005 0.1995 0'
+  [../]
+  [./bands_surface]
+    # Element centered 0.5 mm below the surface
+    type = PointValue
+    variable = flux_bands
+    point = '0.0005 0.3995 0'
+  [../]
+  [./bands_10mm]
+    # Element centered 10.5 mm below the surface
+    type = PointValue
+    variable = flux_bands
+    point = '0.0005 0.3895 0'
+  [../]
+  [./bands_above_layer]
+    # Element centered 49.5 mm below the surface
+    type = PointValue
+    variable = flux_bands
+    point = '0.0005 0.3505 0'
+  [../]
+  [./bands_below_layer]
+    # Element centered 50.5 mm below the surface
+    type = PointValue
+    variable = flux_bands
+    point = '0.0005 0.3495 0'
+  [../]
+  [./bands_deep]
+    # Element centered 200.5 mm below the surface
+    type = PointValue
+    variable = flux_bands
+    point = '0.0005 0.1995 0'
+  [../]
+  [./layers_surface]
+    # Element centered 0.5 mm below the surface
+    type = PointValue
+    variable = flux_layers
+    point = '0.0005 0.3995 0'
+  [../]
+  [./layers_10mm]
+    # Element centered 10.5 mm below the surface
+    type = PointValue
+    variable = flux_layers
+    point = '0.0005 0.3895 0'
+  [../]
+  [./layers_above_layer]
+    # Element centered 49.5 mm below the surface
+    type = PointValue
+    variable = flux_layers
+    point = '0.0005 0.3505 0'
+  [../]
+  [./layers_below_layer]
+    # Element centered 50.5 mm below the surface
+    type = PointValue
+    variable = flux_layers
+    point = '0.0005 0.3495 0'
+  [../]
+  [./layers_deep]
+    # Element centered 200.5 mm below the surface
+    type = PointValue
+    variable = flux_layers
+    point = '0.0005 0.1995 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  solve_type = NEWTON
+  [./Quadrature]
+    # Integrates the exponential profiles to round-off
+    order = TENTH
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
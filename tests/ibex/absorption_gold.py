@@ -0,0 +1,51 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Exact element averages of the net short-wave flux absorbed below each depth sampled by
+# absorption.i, used to generate gold/absorption_out.csv. The default configuration uses the
+# single layer VIS and NIR expression of the kernel before the bands and layers were added.
+# Run from this directory: python absorption_gold.py > gold/absorption_out.csv
+from __future__ import print_function
+import math
+
+short_wave, h = 800., 0.001
+depths = [('surface', 0.0005), ('10mm', 0.0105), ('above_layer', 0.0495), ('below_layer', 0.0505), ('deep', 0.2005)]
+
+def baseline(d1, d2):
+  """Integral of the VIS and NIR flux of the kernel before the bands were added"""
+  q = 0
+  for fraction, albedo, kappa in [(0.545, 0.94, 40.), (0.274, 0.80, 110.)]:
+    q += fraction * (1 - albedo) * ((d2 - d1) - (math.exp(-kappa * d1) - math.exp(-kappa * d2)) / kappa)
+  return q
+
+def layered(fractions, albedos, layer_depths, extinction):
+  """Integral of the flux through the layers, for an interval within a single layer"""
+  tops = [0.] + layer_depths
+  def integral(d1, d2):
+    l = max(i for i, top in enumerate(tops) if top <= d1)
+    q = 0
+    for fraction, albedo, kappa in zip(fractions, albedos, extinction):
+      tau = sum(kappa[i] * (tops[i + 1] - tops[i]) for i in range(l)) + kappa[l] * (d1 - tops[l])
+      q += fraction * (1 - albedo) * ((d2 - d1) - math.exp(-tau) * (1 - math.exp(-kappa[l] * (d2 - d1))) / kappa[l])
+    return q
+  return integral
+
+configs = [('default', baseline),
+           ('bands', layered([0.545, 0.274], [0.94, 0.80], [], [[40.], [110.]])),
+           ('layers', layered([0.4, 0.3, 0.1], [0.95, 0.85, 0.6], [0.05], [[30., 40.], [90., 110.], [300., 400.]]))]
+
+columns = [(name + '_' + d, short_wave * integral(depth - h / 2, depth + h / 2) / h) for name, integral in configs for d, depth in depths]
+columns.sort()
+print(','.join(['time'] + [c[0] for c in columns]))
+print(','.join(['1'] + ['%.14g' % c[1] for c in columns]))
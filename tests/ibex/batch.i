@@ -0,0 +1,47 @@
+# Five snow columns with their own properties driven by the station record of forcing.i, read at
+# the simulation time (station) and 45 minutes ahead (station_ahead)
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[UserObjects]
+  [./station]
+    type = IbexMeteorologicalForcing
+    file = station.csv
+    time_column = minute
+    time_scale = 0.0166666666667
+  [../]
+  [./station_ahead]
+    type = IbexMeteorologicalForcing
+    file = station.csv
+    time_column = minute
+    time_scale = 0.0166666666667
+    time_offset = 45
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./columns]
+    type = IbexColumnBatch
+    columns = columns.csv
+    forcing = 'station station_ahead'
+    num_elements = 100
+    block_size = 2
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 300
+  end_time = 3600
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,59 @@
+# A single column of the batch solver with the snow and forcing of batch_fe.i
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[UserObjects]
+  [./station]
+    type = IbexMeteorologicalForcing
+    file = station.csv
+    time_column = minute
+    time_scale = 0.0166666666667
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./columns]
+    type = IbexColumnBatch
+    forcing = station
+    num_elements = 100
+    snow_density = 174
+    thermal_conductivity = 0.1
+  [../]
+[]
+
+[Postprocessors]
+  [./T_surface]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = columns
+    vector_name = surface_temperature
+    index = 0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./T_mean]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = columns
+    vector_name = mean_temperature
+    index = 0
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 300
+  end_time = 3600
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    show = 'T_surface T_mean'
+  [../]
+[]
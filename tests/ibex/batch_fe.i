@@ -0,0 +1,100 @@
+# Finite element solution of the column of batch_column.i, the physics of problems/ibex/ibex_1d.i
+# driven by the station record of forcing.i with the optical properties of IbexColumnBatch
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 100
+  xmax = 0.4
+[]
+
+[Variables]
+  [./T]
+  [../]
+[]
+
+[Kernels]
+  [./T_diffusion]
+    type = HeatConduction
+    variable = T
+  [../]
+  [./T_time]
+    type = HeatConductionTimeDerivative
+    variable = T
+  [../]
+  [./T_shortwave]
+    type = IbexShortwaveForcingFunction
+    variable = T
+    forcing = station
+    direction = x
+    vis_albedo = 0.96
+    nir_albedo = 0.80
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = IbexSurfaceFluxBC
+    variable = T
+    boundary = right
+    forcing = station
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = T
+    boundary = left
+    value = 262.65
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T
+    snow_density = 174
+    thermal_conductivity = 0.1
+  [../]
+[]
+
+[UserObjects]
+  [./station]
+    type = IbexMeteorologicalForcing
+    file = station.csv
+    time_column = minute
+    time_scale = 0.0166666666667
+  [../]
+[]
+
+[Postprocessors]
+  [./T_surface]
+    type = PointValue
+    variable = T
+    point = '0.4 0 0'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./T_mean]
+    type = ElementAverageValue
+    variable = T
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 300
+  end_time = 3600
+  solve_type = PJFNK
+  nl_rel_tol = 1e-10
+[]
+
+[ICs]
+  [./T_initial]
+    variable = T
+    type = ConstantIC
+    value = 262.65
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
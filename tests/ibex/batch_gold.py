@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Independent solution of the columns of batch.i used to generate the golds
+# gold/batch_out_columns_0006.csv and gold/batch_out_columns_0012.csv: one column at a time,
+# lumped mass linear elements, implicit Euler with the specific heat of the previous step, the
+# surface balance of IbexSurfaceFluxBC linearized about the previous surface temperature, and the
+# short-wave absorption sampled at the nodes, with the stations interpolated at the end of each
+# timestep. Run from this directory: python batch_gold.py
+from __future__ import print_function
+import csv, math
+
+# batch.i
+num_elements, depth = 100, 0.4
+dt, num_steps = 300., 12
+time_scale = 0.0166666666667
+time_offsets = [0., 45.]
+initial_temperature = 262.65
+outputs = [6, 12]
+
+# IbexColumnBatch defaults
+pressure, swir_albedo, emissivity = 101.325, 0.59, 0.988
+ratio, latent_heat, transport, vapor_transport = 0.622, 2833., 0.0023, 0.0023
+T_ref, e_ref, cp_air = 268.15, 0.402, 1.012
+boltzmann, R_air, R_vapor = 5.670e-8, 0.622, 0.287
+bands = [(0.545, 0.96, 40.), (0.274, 0.80, 110.)]
+
+with open('station.csv') as f:
+  rows = [[float(v) for v in row] for row in list(csv.reader(f))[1:]]
+
+with open('columns.csv') as f:
+  columns = [dict((key, float(value)) for key, value in row.items()) for row in csv.DictReader(f)]
+
+def forcing(r):
+  """Record columns linearly interpolated at record time r"""
+  for a, b in zip(rows[:-1], rows[1:]):
+    if a[0] <= r <= b[0]:
+      w = (r - a[0]) / (b[0] - a[0])
+      return [(1 - w) * p + w * q for p, q in zip(a[1:], b[1:])]
+  return rows[-1][1:] if r > rows[-1][0] else rows[0][1:]
+
+def clausiusClapeyron(T):
+  return e_ref * math.exp(latent_heat / R_vapor * (1 / T_ref - 1 / T))
+
+def surfaceFlux(T, air_T, rh, velocity, lw, sw):
+  rho_air = pressure / (R_air * air_T)
+  e_air = clausiusClapeyron(air_T) * rh / 100
+  latent = ratio * rho_air * latent_heat * vapor_transport * velocity / pressure
+  sensible = rho_air * cp_air * transport * velocity
+  flux = (lw - emissivity * boltzmann * T**4 + 0.094 * sw * (1 - swir_albedo)
+          + latent * (e_air - clausiusClapeyron(T)) + sensible * (air_T - T))
+  dflux = (-4 * emissivity * boltzmann * T**3
+           - latent * clausiusClapeyron(T) * latent_heat / R_vapor / T**2 - sensible)
+  return flux, dflux
+
+h = depth / num_elements
+absorbed = [sum(frac * (1 - albedo) * kappa * math.exp(-kappa * (depth - i * h)) for frac, albedo, kappa in bands)
+            for i in range(num_elements + 1)]
+
+def step(T, column, t):
+  """Advances the nodal temperatures T of a column to time t"""
+  N = num_elements
+  air_T, rh, velocity, lw, sw = forcing(time_scale * t + time_offsets[int(column['forcing'])])
+  air_T += column['air_temperature_offset']
+  sw *= column['short_wave_factor']
+  rho = column['snow_density']
+  k = 0.021 + 2.5 * (rho / 1000)**2
+
+  # Tridiagonal system, the bottom temperature is fixed
+  a, b, c, d = [0.] * (N + 1), [1.] * (N + 1), [0.] * (N + 1), [column['bottom_temperature']] * (N + 1)
+  for i in range(1, N + 1):
+    weight = h if i < N else 0.5 * h
+    m = rho * 1000 * (2.115 + 0.00779 * (273.15 - T[i])) * weight / dt
+    a[i] = -k / h
+    b[i] = m + (2 if i < N else 1) * k / h
+    c[i] = -k / h if i < N else 0.
+    d[i] = m * T[i] + sw * absorbed[i] * weight
+  flux, dflux = surfaceFlux(T[N], air_T, rh, velocity, lw, sw)
+  b[N] -= dflux
+  d[N] += flux - dflux * T[N]
+
+  for i in range(1, N + 1):
+    w = a[i] / b[i - 1]
+    b[i] -= w * c[i - 1]
+    d[i] -= w * d[i - 1]
+  T[N] = d[N] / b[N]
+  for i in reversed(range(N)):
+    T[i] = (d[i] - c[i] * T[i + 1]) / b[i]
+
+temperatures = [[initial_temperature] * (num_elements + 1) for column in columns]
+for n in range(1, num_steps + 1):
+  for T, column in zip(temperatures, columns):
+    step(T, column, n * dt)
+  if n in outputs:
+    with open('gold/batch_out_columns_%04d.csv' % n, 'w') as f:
+      f.write('column,mean_temperature,surface_temperature\n')
+      for j, T in enumerate(temperatures):
+        mean = (sum(T) - 0.5 * (T[0] + T[-1])) / num_elements
+        f.write('%d,%.14g,%.14g\n' % (j, mean, T[-1]))
@@ -0,0 +1,96 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 20
+  xmax = 0.1
+  ymax = 0.4
+  uniform_refine = 1
+[]
+
+[Variables]
+  [./T]
+  [../]
+[]
+
+[Functions]
+  [./short_wave]
+    type = ParsedFunction
+    value = 'max(0, 800*sin(pi*t/43200))'
+  [../]
+[]
+
+[Kernels]
+  [./T_diffusion]
+    type = HeatConduction
+    variable = T
+  [../]
+  [./T_time]
+    type = HeatConductionTimeDerivative
+    variable = T
+  [../]
+  [./T_shortwave]
+    # Three bands absorbed through a 5 cm surface layer over the remaining snowpack
+    type = IbexShortwaveForcingFunction
+    variable = T
+    short_wave = short_wave
+    depth = depth
+    band_fractions = '0.4 0.3 0.1'
+    band_albedos = '0.95 0.85 0.6'
+    layer_depths = 0.05
+    extinction = '30 40 90 110 300 400'
+  [../]
+[]
+
+[BCs]
+  [./bottom]
+    type = DirichletBC
+    variable = T
+    boundary = bottom
+    value = 262.65
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T
+    snow_density = 174
+    thermal_conductivity = 0.1
+  [../]
+[]
+
+[UserObjects]
+  [./depth]
+    type = IbexSnowDepth
+    surface = top
+  [../]
+[]
+
+[Postprocessors]
+  [./T_surface]
+    type = PointValue
+    variable = T
+    point = '0.05 0.4 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 600
+  end_time = 3600
+  solve_type = PJFNK
+[]
+
+[ICs]
+  [./T_initial]
+    variable = T
+    type = ConstantIC
+    value = 262.65
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,115 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 20
+  xmax = 0.4
+[]
+
+[Variables]
+  [./T]
+  [../]
+[]
+
+[Kernels]
+  [./T_diffusion]
+    type = HeatConduction
+    variable = T
+  [../]
+  [./T_time]
+    type = HeatConductionTimeDerivative
+    variable = T
+  [../]
+  [./T_shortwave]
+    type = IbexShortwaveForcingFunction
+    variable = T
+    forcing = station
+    direction = x
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = IbexSurfaceFluxBC
+    variable = T
+    boundary = right
+    forcing = station
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = T
+    boundary = left
+    value = 262.65
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T
+    snow_density = 174
+    thermal_conductivity = 0.1
+  [../]
+[]
+
+[UserObjects]
+  # Minute resolution record, read eight rows at a time
+  [./station]
+    type = IbexMeteorologicalForcing
+    file = station.csv
+    time_column = minute
+    time_scale = 0.0166666666667
+    chunk_size = 8
+  [../]
+  # Fails the step ending at 1200 s once, enabled by the forcing_cutback test; the repeated step
+  # at 1050 s precedes the discarded rows, so the record is read again from the start
+  [./cut]
+    type = Terminator
+    expression = 'time > 1100 & time < 1300 & dt > 200'
+    fail_mode = SOFT
+    enable = false
+  [../]
+[]
+
+[Functions]
+  [./time]
+    type = ParsedFunction
+    value = t
+  [../]
+[]
+
+[Postprocessors]
+  [./T_surface]
+    type = PointValue
+    variable = T
+    point = '0.4 0 0'
+  [../]
+  [./time]
+    type = FunctionValuePostprocessor
+    function = time
+    outputs = none
+  [../]
+  [./dt]
+    type = TimestepSize
+    outputs = none
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 300
+  end_time = 3600
+  solve_type = PJFNK
+[]
+
+[ICs]
+  [./T_initial]
+    variable = T
+    type = ConstantIC
+    value = 262.65
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Independent solution of forcing.i used to generate gold/forcing_out.csv: linear elements with
+# two-point Gauss quadrature, implicit Euler, and the IbexSurfaceFluxBC and
+# IbexShortwaveForcingFunction terms evaluated with station.csv interpolated at the end of each
+# timestep. Run from this directory: python forcing_gold.py --binary station.bin > gold/forcing_out.csv
+#
+# --binary writes a copy of station.csv as float64 records in little-endian byte order, as read by
+# IbexMeteorologicalForcing with format = binary. --cut TIME halves the step ending at TIME and
+# restores the timestep afterwards, as ConstantDT does after a failed step:
+# python forcing_gold.py --cut 1200 > gold/forcing_cutback.csv
+from __future__ import print_function
+import argparse, csv, math, struct
+
+# forcing.i
+nx, length = 20, 0.4
+step, end_time = 300., 3600.
+T_initial = T_bottom = 262.65
+density, conductivity = 174., 0.1
+time_scale = 0.0166666666667
+
+# IbexSurfaceFluxBC defaults
+pressure, swir_albedo, emissivity = 101.325, 0.59, 0.988
+ratio, latent_heat, transport, vapor_transport = 0.622, 2833., 0.0023, 0.0023
+T_ref, e_ref, cp_air = 268.15, 0.402, 1.012
+boltzmann, R_air, R_vapor = 5.670e-8, 0.622, 0.287
+
+# IbexShortwaveForcingFunction defaults (VIS and NIR bands in a single layer)
+bands = [(0.545, 0.94, 40.), (0.274, 0.80, 110.)]
+
+parser = argparse.ArgumentParser(description='Independent solution of forcing.i')
+parser.add_argument('--binary', help='Write station.csv as binary float64 records to this file')
+parser.add_argument('--cut', type=float, help='Time at the end of the step that is cut in half')
+args = parser.parse_args()
+
+with open('station.csv') as f:
+  rows = [[float(v) for v in row] for row in list(csv.reader(f))[1:]]
+
+if args.binary:
+  with open(args.binary, 'wb') as f:
+    for row in rows:
+      f.write(struct.pack('<%dd' % len(row), *row))
+
+def forcing(t):
+  """Record columns linearly interpolated at simulation time t"""
+  r = time_scale * t
+  for a, b in zip(rows[:-1], rows[1:]):
+    if a[0] <= r <= b[0]:
+      w = (r - a[0]) / (b[0] - a[0])
+      return [(1 - w) * p + w * q for p, q in zip(a[1:], b[1:])]
+  return rows[-1][1:] if r > rows[-1][0] else rows[0][1:]
+
+def clausiusClapeyron(T):
+  return e_ref * math.exp(latent_heat / R_vapor * (1 / T_ref - 1 / T))
+
+def surfaceFlux(T, f):
+  air_T, rh, velocity, lw, sw = f
+  rho_air = pressure / (R_air * air_T)
+  e_air = clausiusClapeyron(air_T) * rh / 100
+  return (lw - emissivity * boltzmann * T**4
+          + 0.094 * sw * (1 - swir_albedo)
+          + ratio * rho_air * latent_heat * vapor_transport * velocity * (e_air - clausiusClapeyron(T)) / pressure
+          + rho_air * cp_air * transport * velocity * (air_T - T))
+
+def netFluxFraction(depth):
+  return sum(frac * (1 - albedo) * (1 - math.exp(-kappa * depth)) for frac, albedo, kappa in bands)
+
+h = length / nx
+gauss = [(0.5 - 0.5 / math.sqrt(3), 0.5 * h), (0.5 + 0.5 / math.sqrt(3), 0.5 * h)]
+
+def residual(T, T_old, t, dt):
+  f = forcing(t)
+  R = [0.] * (nx + 1)
+  for e in range(nx):
+    for s, w in gauss:
+      phi = [1 - s, s]
+      dphi = [-1 / h, 1 / h]
+      x = (e + s) * h
+      u = phi[0] * T[e] + phi[1] * T[e + 1]
+      u_old = phi[0] * T_old[e] + phi[1] * T_old[e + 1]
+      grad_u = (T[e + 1] - T[e]) / h
+      cp = 1000 * (2.115 + 0.00779 * (273.15 - u))
+      source = f[4] * netFluxFraction(length - x)
+      for i in range(2):
+        R[e + i] += w * (conductivity * grad_u * dphi[i] + density * cp * (u - u_old) / dt * phi[i] - dphi[i] * source)
+  R[nx] -= surfaceFlux(T[nx], f)
+  R[0] = T[0] - T_bottom
+  return R
+
+def solve(A, b):
+  n = len(b)
+  M = [row[:] + [b[i]] for i, row in enumerate(A)]
+  for k in range(n):
+    p = max(range(k, n), key=lambda i: abs(M[i][k]))
+    M[k], M[p] = M[p], M[k]
+    for i in range(k + 1, n):
+      m = M[i][k] / M[k][k]
+      for j in range(k, n + 1):
+        M[i][j] -= m * M[k][j]
+  x = [0.] * n
+  for i in reversed(range(n)):
+    x[i] = (M[i][n] - sum(M[i][j] * x[j] for j in range(i + 1, n))) / M[i][i]
+  return x
+
+T = [T_initial] * (nx + 1)
+print('time,T_surface')
+print('0,%.14g' % T[nx])
+t = 0.
+while t < end_time - 1e-8:
+  dt = min(step, end_time - t)
+  if args.cut is not None and abs(t + dt - args.cut) < 1e-8:
+    dt *= 0.5
+  t += dt
+  T_old = T[:]
+  for it in range(50):
+    R = residual(T, T_old, t, dt)
+    if max(abs(r) for r in R) < 1e-12:
+      break
+    J = [[0.] * (nx + 1) for i in range(nx + 1)]
+    for j in range(nx + 1):
+      Tp = T[:]
+      eps = 1e-7 * max(1., abs(T[j]))
+      Tp[j] += eps
+      Rp = residual(Tp, T_old, t, dt)
+      for i in range(nx + 1):
+        J[i][j] = (Rp[i] - R[i]) / eps
+    dT = solve(J, [-r for r in R])
+    T = [a + b for a, b in zip(T, dT)]
+  print('%.14g,%.14g' % (t, T[nx]))
@@ -0,0 +1,75 @@
+# Fine propagator, the time stepping is controlled by the PikaParareal master
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 40
+  xmax = 0.4
+[]
+
+[Variables]
+  [./T]
+  [../]
+[]
+
+[Functions]
+  [./short_wave]
+    type = ParsedFunction
+    value = 'max(0, 650*sin(pi*t/28800))'
+  [../]
+[]
+
+[Kernels]
+  [./T_diffusion]
+    type = HeatConduction
+    variable = T
+  [../]
+  [./T_time]
+    type = HeatConductionTimeDerivative
+    variable = T
+  [../]
+  [./T_shortwave]
+    type = IbexShortwaveForcingFunction
+    variable = T
+    short_wave = short_wave
+    direction = x
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = IbexSurfaceFluxBC
+    variable = T
+    boundary = right
+    long_wave = 235
+    short_wave = short_wave
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = T
+    boundary = left
+    value = 264.15
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T
+    snow_density = 174
+  [../]
+[]
+
+[Executioner]
+  # The time slices are advanced by the PikaParareal executioner of parareal.i
+  type = Transient
+  solve_type = PJFNK
+[]
+
+[ICs]
+  [./T_initial]
+    variable = T
+    type = ConstantIC
+    value = 264.15
+  [../]
+[]
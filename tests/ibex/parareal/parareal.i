@@ -0,0 +1,103 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 40
+  xmax = 0.4
+[]
+
+[Variables]
+  [./T]
+  [../]
+[]
+
+[Functions]
+  [./short_wave]
+    type = ParsedFunction
+    value = 'max(0, 650*sin(pi*t/28800))'
+  [../]
+[]
+
+[Kernels]
+  [./T_diffusion]
+    type = HeatConduction
+    variable = T
+  [../]
+  [./T_time]
+    type = HeatConductionTimeDerivative
+    variable = T
+  [../]
+  [./T_shortwave]
+    type = IbexShortwaveForcingFunction
+    variable = T
+    short_wave = short_wave
+    direction = x
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = IbexSurfaceFluxBC
+    variable = T
+    boundary = right
+    long_wave = 235
+    short_wave = short_wave
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = T
+    boundary = left
+    value = 264.15
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T
+    snow_density = 174
+  [../]
+[]
+
+[MultiApps]
+  # One fine propagator per time slice, run by the PikaParareal executioner
+  [./fine]
+    type = TransientMultiApp
+    input_files = fine.i
+    positions = '0 0 0  0 0 0  0 0 0  0 0 0'
+    execute_on = custom
+  [../]
+[]
+
+[Postprocessors]
+  [./T_surface]
+    type = PointValue
+    variable = T
+    point = '0.4 0 0'
+  [../]
+[]
+
+[Executioner]
+  # Four 2 hour slices, each with a single coarse step and 24 fine steps
+  type = PikaParareal
+  fine_app = fine
+  end_time = 28800
+  coarse_steps = 1
+  fine_steps = 24
+  # One iteration per slice reproduces the serial fine solution
+  max_parareal_iterations = 4
+  parareal_tolerance = 0
+  solve_type = PJFNK
+[]
+
+[ICs]
+  [./T_initial]
+    variable = T
+    type = ConstantIC
+    value = 264.15
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
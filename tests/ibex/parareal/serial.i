@@ -0,0 +1,94 @@
+# Serial solution with the fine propagator of parareal.i over the whole interval, the reference for
+# the parareal solution at the end of each slice
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 40
+  xmax = 0.4
+[]
+
+[Variables]
+  [./T]
+  [../]
+[]
+
+[Functions]
+  [./short_wave]
+    type = ParsedFunction
+    value = 'max(0, 650*sin(pi*t/28800))'
+  [../]
+[]
+
+[Kernels]
+  [./T_diffusion]
+    type = HeatConduction
+    variable = T
+  [../]
+  [./T_time]
+    type = HeatConductionTimeDerivative
+    variable = T
+  [../]
+  [./T_shortwave]
+    type = IbexShortwaveForcingFunction
+    variable = T
+    short_wave = short_wave
+    direction = x
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = IbexSurfaceFluxBC
+    variable = T
+    boundary = right
+    long_wave = 235
+    short_wave = short_wave
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = T
+    boundary = left
+    value = 264.15
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T
+    snow_density = 174
+  [../]
+[]
+
+[Postprocessors]
+  [./T_surface]
+    type = PointValue
+    variable = T
+    point = '0.4 0 0'
+  [../]
+[]
+
+[Executioner]
+  # The fine step of parareal.i: four slices of 24 steps
+  type = Transient
+  dt = 300
+  end_time = 28800
+  solve_type = PJFNK
+[]
+
+[ICs]
+  [./T_initial]
+    variable = T
+    type = ConstantIC
+    value = 264.15
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    # The end of each slice
+    type = CSV
+    interval = 24
+  [../]
+[]
@@ -0,0 +1,248 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 40
+  xmax = 0.4
+[]
+
+[Variables]
+  [./T]
+  [../]
+[]
+
+[AuxVariables]
+  [./density]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./thermal_conductivity]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./grain_size]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./specific_heat]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[AuxKernels]
+  [./density]
+    type = MaterialRealAux
+    variable = density
+    property = density
+    execute_on = initial
+  [../]
+  [./thermal_conductivity]
+    type = MaterialRealAux
+    variable = thermal_conductivity
+    property = thermal_conductivity
+    execute_on = initial
+  [../]
+  [./grain_size]
+    type = MaterialRealAux
+    variable = grain_size
+    property = grain_size
+    execute_on = initial
+  [../]
+  [./specific_heat]
+    type = MaterialRealAux
+    variable = specific_heat
+    property = specific_heat
+    execute_on = initial
+  [../]
+[]
+
+[Kernels]
+  [./T_diffusion]
+    type = HeatConduction
+    variable = T
+  [../]
+  [./T_time]
+    type = HeatConductionTimeDerivative
+    variable = T
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = DirichletBC
+    variable = T
+    boundary = right
+    value = 258.15
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = T
+    boundary = left
+    value = 262.65
+  [../]
+[]
+
+[Materials]
+  [./snow]
+    type = IbexSnowMaterial
+    block = 0
+    temperature = T
+    stratigraphy = layers
+  [../]
+[]
+
+[UserObjects]
+  # Four layers, measured down from the right end of the mesh
+  [./layers]
+    type = IbexStratigraphy
+    file = stratigraphy.csv
+    direction = x
+  [../]
+[]
+
+[Postprocessors]
+  [./T_middle]
+    type = PointValue
+    variable = T
+    point = '0.2 0 0'
+  [../]
+  [./density_0]
+    # Element centered 2.5 cm below the surface
+    type = PointValue
+    variable = density
+    point = '0.375 0 0'
+    execute_on = initial
+  [../]
+  [./thermal_conductivity_0]
+    # Element centered 2.5 cm below the surface
+    type = PointValue
+    variable = thermal_conductivity
+    point = '0.375 0 0'
+    execute_on = initial
+  [../]
+  [./grain_size_0]
+    # Element centered 2.5 cm below the surface
+    type = PointValue
+    variable = grain_size
+    point = '0.375 0 0'
+    execute_on = initial
+  [../]
+  [./specific_heat_0]
+    # Element centered 2.5 cm below the surface
+    type = PointValue
+    variable = specific_heat
+    point = '0.375 0 0'
+    execute_on = initial
+  [../]
+  [./density_1]
+    # Element centered 10.5 cm below the surface
+    type = PointValue
+    variable = density
+    point = '0.295 0 0'
+    execute_on = initial
+  [../]
+  [./thermal_conductivity_1]
+    # Element centered 10.5 cm below the surface
+    type = PointValue
+    variable = thermal_conductivity
+    point = '0.295 0 0'
+    execute_on = initial
+  [../]
+  [./grain_size_1]
+    # Element centered 10.5 cm below the surface
+    type = PointValue
+    variable = grain_size
+    point = '0.295 0 0'
+    execute_on = initial
+  [../]
+  [./specific_heat_1]
+    # Element centered 10.5 cm below the surface
+    type = PointValue
+    variable = specific_heat
+    point = '0.295 0 0'
+    execute_on = initial
+  [../]
+  [./density_2]
+    # Element centered 20.5 cm below the surface
+    type = PointValue
+    variable = density
+    point = '0.195 0 0'
+    execute_on = initial
+  [../]
+  [./thermal_conductivity_2]
+    # Element centered 20.5 cm below the surface
+    type = PointValue
+    variable = thermal_conductivity
+    point = '0.195 0 0'
+    execute_on = initial
+  [../]
+  [./grain_size_2]
+    # Element centered 20.5 cm below the surface
+    type = PointValue
+    variable = grain_size
+    point = '0.195 0 0'
+    execute_on = initial
+  [../]
+  [./specific_heat_2]
+    # Element centered 20.5 cm below the surface
+    type = PointValue
+    variable = specific_heat
+    point = '0.195 0 0'
+    execute_on = initial
+  [../]
+  [./density_3]
+    # Element centered 35.5 cm below the surface
+    type = PointValue
+    variable = density
+    point = '0.045 0 0'
+    execute_on = initial
+  [../]
+  [./thermal_conductivity_3]
+    # Element centered 35.5 cm below the surface
+    type = PointValue
+    variable = thermal_conductivity
+    point = '0.045 0 0'
+    execute_on = initial
+  [../]
+  [./grain_size_3]
+    # Element centered 35.5 cm below the surface
+    type = PointValue
+    variable = grain_size
+    point = '0.045 0 0'
+    execute_on = initial
+  [../]
+  [./specific_heat_3]
+    # Element centered 35.5 cm below the surface
+    type = PointValue
+    variable = specific_heat
+    point = '0.045 0 0'
+    execute_on = initial
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 600
+  end_time = 3600
+  solve_type = PJFNK
+[]
+
+[ICs]
+  [./T_initial]
+    # Linear between the boundary temperatures, so the specific heat varies within each layer
+    variable = T
+    type = FunctionIC
+    function = 262.65-11.25*x
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  [./properties]
+    # Layer properties and the tabulated specific heat of the initial temperature profile
+    type = CSV
+    file_base = stratigraphy_properties
+    execute_on = initial
+    hide = T_middle
+  [../]
+[]
@@ -0,0 +1,219 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 20
+  xmax = 0.0025
+  ymax = 0.005
+[]
+
+[Variables]
+  [./T]
+  [../]
+  [./u]
+  [../]
+  [./phi]
+  [../]
+[]
+
+[AuxVariables]
+  [./phi_initial]
+  [../]
+[]
+
+[Functions]
+  [./T_func]
+    type = ParsedFunction
+    value = -543*y+267.515
+  [../]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.001-sqrt((x-0.00125)^2+(y-0.0025)^2))/(sqrt(2)*1e-4))'
+  [../]
+[]
+
+[Kernels]
+  [./heat_diffusion]
+    type = PikaDiffusion
+    variable = T
+    use_temporal_scaling = true
+    property = conductivity
+  [../]
+  [./heat_time]
+    type = PikaTimeDerivative
+    variable = T
+    property = heat_capacity
+    scale = 1.0
+  [../]
+  [./heat_phi_time]
+    type = PikaCoupledTimeDerivative
+    variable = T
+    property = latent_heat
+    scale = -0.5
+    use_temporal_scaling = true
+    coupled_variable = phi
+  [../]
+  [./vapor_time]
+    type = PikaTimeDerivative
+    variable = u
+    coefficient = 1.0
+    scale = 1.0
+  [../]
+  [./vapor_diffusion]
+    type = PikaDiffusion
+    variable = u
+    use_temporal_scaling = true
+    property = diffusion_coefficient
+  [../]
+  [./vapor_phi_time]
+    type = PikaCoupledTimeDerivative
+    variable = u
+    coefficient = 0.5
+    coupled_variable = phi
+    use_temporal_scaling = true
+  [../]
+  [./phi_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+    scale = 1.0
+  [../]
+  [./phi_transition]
+    type = PhaseTransition
+    variable = phi
+    mob_name = mobility
+    chemical_potential = u
+    coefficient = 1.0
+    lambda = phase_field_coupling_constant
+  [../]
+  [./phi_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+  [./phi_square_gradient]
+    type = ACInterface
+    variable = phi
+    mob_name = mobility
+    kappa_name = interface_thickness_squared
+  [../]
+[]
+
+[BCs]
+  [./T_hot]
+    type = DirichletBC
+    variable = T
+    boundary = bottom
+    value = 267.515
+  [../]
+  [./T_cold]
+    type = DirichletBC
+    variable = T
+    boundary = top
+    value = 264.8
+  [../]
+[]
+
+[Postprocessors]
+  [./u_max]
+    type = NodalExtremeValue
+    variable = u
+  [../]
+  [./dt]
+    type = TimestepSize
+  [../]
+
+  # Change of the phase by the initialization and of the averages of T and u over the first
+  # timestep, which vanish at the quasi-steady state when the phase kernels are disabled
+  [./phi_change]
+    type = ElementL2Difference
+    variable = phi
+    other_variable = phi_initial
+    execute_on = timestep_begin
+  [../]
+  [./T_begin]
+    type = ElementAverageValue
+    variable = T
+    execute_on = timestep_begin
+  [../]
+  [./T_end]
+    type = ElementAverageValue
+    variable = T
+  [../]
+  [./u_begin]
+    type = ElementAverageValue
+    variable = u
+    execute_on = timestep_begin
+  [../]
+  [./u_end]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./T_change]
+    type = ParsedPostprocessor
+    function = 'abs(T_end - T_begin)'
+    pp_names = 'T_begin T_end'
+  [../]
+  [./u_change]
+    # Relative to the average chemical potential
+    type = ParsedPostprocessor
+    function = 'abs(u_end - u_begin) / abs(u_begin)'
+    pp_names = 'u_begin u_end'
+  [../]
+[]
+
+[Executioner]
+  # The phase is held while T and u are relaxed to their quasi-steady state
+  type = PikaTransient
+  steady_initialization = true
+  hold_variables = phi
+  solve_type = PJFNK
+  end_time = 10
+  nl_rel_tol = 1e-07
+  [./TimeStepper]
+    type = IterationAdaptiveDT
+    dt = 1
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  [./steady_state]
+    type = CSV
+    file_base = steady_state
+    show = 'phi_change T_change u_change'
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+  [./phase_initial_ic]
+    variable = phi_initial
+    type = FunctionIC
+    function = phi_func
+  [../]
+  [./temperature_ic]
+    variable = T
+    type = FunctionIC
+    function = T_func
+  [../]
+  [./vapor_ic]
+    variable = u
+    type = PikaChemicalPotentialIC
+    block = 0
+    phase_variable = phi
+    temperature = T
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = T
+  interface_thickness = 1e-4
+  temporal_scaling = 1e-4
+  condensation_coefficient = .01
+  phase = phi
+[]
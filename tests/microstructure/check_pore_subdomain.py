@@ -0,0 +1,43 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Checks the per-step CSV file of pore_subdomain.i: one row for each timestep and a number of
+# nonlinear degrees of freedom that grows from step to step, i.e. the move after each step adds
+# the vapor of the elements left by the sublimating ice. A solution of the same discrete problem
+# gives 3162, 3166 and 3178 degrees of freedom.
+# Usage: python check_pore_subdomain.py <file> <number of timesteps>
+from __future__ import print_function
+import sys, csv
+
+def check(filename, num_steps):
+  try:
+    with open(filename) as f:
+      rows = list(csv.DictReader(f))
+  except IOError as e:
+    return str(e)
+
+  if len(rows) != num_steps:
+    return '{} has {} rows, expected {}'.format(filename, len(rows), num_steps)
+
+  dofs = [int(float(row['dofs'])) for row in rows]
+  for previous, current, row in zip(dofs[:-1], dofs[1:], rows[1:]):
+    if current <= previous:
+      return 'The degrees of freedom did not grow at time {}: {}'.format(row['time'], ' '.join(map(str, dofs)))
+  print('{}: {} degrees of freedom'.format(filename, ' '.join(map(str, dofs))))
+  return None
+
+if __name__ == '__main__':
+  error = check(sys.argv[1], int(sys.argv[2]))
+  if error:
+    sys.exit(error)
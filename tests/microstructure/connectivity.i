@@ -0,0 +1,92 @@
+# Two isolated grains and a band spanning the domain in the x-direction: three components,
+# one of which percolates along x. The shapes do not pass through any node, and an element is ice
+# if two or more of its nodes are ice (mean phase of 0 or more), so the components are exact:
+# 52 elements for each grain and 400 for the band (largest fraction 400/504)
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 40
+  ny = 40
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'if((x-0.25)^2+(y-0.25)^2<0.0101 | (x-0.75)^2+(y-0.25)^2<0.0101 | abs(y-0.75)<0.11, 1, -1)'
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[UserObjects]
+  [./connectivity]
+    type = PikaIceConnectivity
+    phase = phi
+    threshold = -0.25
+  [../]
+[]
+
+[Postprocessors]
+  [./num_components]
+    type = PikaIceConnectivityPostprocessor
+    connectivity = connectivity
+    quantity = num_components
+    execute_on = 'initial timestep_end'
+  [../]
+  [./largest_fraction]
+    type = PikaIceConnectivityPostprocessor
+    connectivity = connectivity
+    quantity = largest_volume_fraction
+    execute_on = 'initial timestep_end'
+  [../]
+  [./percolating_x]
+    type = PikaIceConnectivityPostprocessor
+    connectivity = connectivity
+    quantity = percolating_x
+    execute_on = 'initial timestep_end'
+  [../]
+  [./percolating_y]
+    type = PikaIceConnectivityPostprocessor
+    connectivity = connectivity
+    quantity = percolating_y
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Outputs]
+  csv = true
+  [./components]
+    # The topology, which does not depend on the mesh refinement
+    type = CSV
+    file_base = connectivity_components
+    show = 'num_components percolating_x percolating_y'
+  [../]
+[]
@@ -0,0 +1,92 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 128
+  ny = 128
+  xmax = 0.002
+  ymax = 0.002
+[]
+
+[Variables]
+  [./phi]
+  [../]
+[]
+
+[UserObjects]
+  # Overlapping elliptical grains covering ~40% of the domain, identical for any partitioning
+  [./grains]
+    type = PikaGrainCatalogue
+    volume_fraction = 0.4
+    radius = 6e-5
+    radius_variation = 0.3
+    aspect_ratio = 2
+    seed = 4
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = PikaGrainIC
+    catalogue = grains
+  [../]
+[]
+
+[Kernels]
+  [./phase_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phase_diffusion]
+    type = PikaDiffusion
+    variable = phi
+    property = interface_thickness_squared
+  [../]
+  [./phase_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = 263.15
+  interface_thickness = 1e-5
+  phase = phi
+  temporal_scaling = 1e-04
+  condensation_coefficient = .01
+[]
+
+[VectorPostprocessors]
+  [./microstructure]
+    type = PikaMicrostructureStatistics
+    phase = phi
+    execute_on = initial
+  [../]
+[]
+
+[Postprocessors]
+  [./ice_fraction]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = microstructure
+    vector_name = ice_volume_fraction
+    index = 0
+    execute_on = initial
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  [./csv]
+    # The initial microstructure
+    type = CSV
+    execute_on = initial
+  [../]
+[]
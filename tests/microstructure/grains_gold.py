@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Independent construction of the grain catalogue of grains.i, used to generate
+# gold/grains_out.csv: the SplitMix64 cell streams of PikaGrainCatalogue are reproduced with
+# 64-bit integer arithmetic, the phase is evaluated at the mesh nodes and the ice fraction of the
+# bilinear interpolant is integrated exactly. Run from this directory:
+# python grains_gold.py > gold/grains_out.csv
+from __future__ import print_function
+import math
+
+# grains.i
+length, nx = 0.002, 128
+radius, variation, aspect_ratio, seed, volume_fraction = 6e-5, 0.3, 2., 4, 0.4
+sqrt2_W = math.sqrt(2.) * 1e-5
+
+MASK = (1 << 64) - 1
+
+class SplitMix64(object):
+  def __init__(self, state):
+    self.state = state & MASK
+
+  def next(self):
+    self.state = (self.state + 0x9e3779b97f4a7c15) & MASK
+    z = self.state
+    z = ((z ^ (z >> 30)) * 0xbf58476d1ce4e5b9) & MASK
+    z = ((z ^ (z >> 27)) * 0x94d049bb133111eb) & MASK
+    return z ^ (z >> 31)
+
+  def uniform(self):
+    return (self.next() >> 11) * (1.0 / 9007199254740992.0)
+
+  def poisson(self, mean):
+    count = 0
+    while mean > 0:
+      piece = min(mean, 50.0)
+      mean -= piece
+      limit = math.exp(-piece)
+      product = self.uniform()
+      while product > limit:
+        count += 1
+        product *= self.uniform()
+    return count
+
+# Number density of the grains and the cell grid
+mean_scale = (math.sqrt(aspect_ratio) - 1 / math.sqrt(aspect_ratio)) / math.log(aspect_ratio)
+grain_measure = math.pi * (radius * mean_scale)**2 * (1 + variation**2 / 3)
+number_density = -math.log(1 - volume_fraction) / grain_measure
+num_cells = max(1, int(length / (radius * (1 + variation) * math.sqrt(aspect_ratio) + 3 * sqrt2_W)))
+cell_size = length / num_cells
+
+def generate(i, j):
+  """The grains (center, transform, smallest axis) of a cell"""
+  rng = SplitMix64(SplitMix64(seed).next() ^ (((j * num_cells + i) * 0xd1b54a32d192ed03) & MASK))
+  rng.next()
+  grains = []
+  for g in range(rng.poisson(number_density * cell_size**2)):
+    center = [(i + rng.uniform()) * cell_size, (j + rng.uniform()) * cell_size]
+    r = radius * (1 + variation * (2 * rng.uniform() - 1))
+    axes = [r * math.pow(aspect_ratio, rng.uniform() - 0.5) for d in range(3)]
+    theta = 2 * math.pi * rng.uniform()
+    rotation = [[math.cos(theta), -math.sin(theta)], [math.sin(theta), math.cos(theta)]]
+    transform = [[rotation[b][a] / axes[a] for b in range(2)] for a in range(2)]
+    grains.append((center, transform, min(axes[0], axes[1])))
+  return grains
+
+cells = dict(((i, j), generate(i, j)) for i in range(num_cells) for j in range(num_cells))
+
+def phase(x, y):
+  ci = min(max(int(math.floor(x / cell_size)), 0), num_cells - 1)
+  cj = min(max(int(math.floor(y / cell_size)), 0), num_cells - 1)
+  distance = None
+  for j in range(max(cj - 1, 0), min(cj + 1, num_cells - 1) + 1):
+    for i in range(max(ci - 1, 0), min(ci + 1, num_cells - 1) + 1):
+      for center, transform, min_axis in cells[(i, j)]:
+        dx, dy = x - center[0], y - center[1]
+        q = [row[0] * dx + row[1] * dy for row in transform]
+        d = (1 - math.sqrt(q[0]**2 + q[1]**2)) * min_axis
+        distance = d if distance is None else max(distance, d)
+  return -1 if distance is None else math.tanh(distance / sqrt2_W)
+
+# Trapezoidal weights integrate the bilinear interpolant exactly
+total = ice = 0
+for j in range(nx + 1):
+  for i in range(nx + 1):
+    w = (0.5 if i in (0, nx) else 1) * (0.5 if j in (0, nx) else 1)
+    total += w
+    ice += w * 0.5 * (1 + phase(i * length / nx, j * length / nx))
+
+print('time,ice_fraction')
+print('0,%.14g' % (ice / total))
@@ -0,0 +1,208 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 32
+  ny = 32
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[MeshModifiers]
+  # Creates the ice subdomain, its extent is set by the 'pore' object; the box exceeds the ice
+  # particle so that the initial move adds vapor degrees of freedom
+  [./ice]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.0001 0.0001 0'
+    top_right = '0.0009 0.0009 0'
+  [../]
+[]
+
+[Variables]
+  [./T]
+  [../]
+  [./u]
+    # Only the pore space and interface band carry vapor
+    block = 0
+  [../]
+  [./phi]
+  [../]
+[]
+
+[AuxVariables]
+  [./u_initial]
+    # The chemical potential initial condition over both subdomains
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.0003-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*2e-5))'
+  [../]
+[]
+
+[ICs]
+  [./T_ic]
+    variable = T
+    type = ConstantIC
+    value = 263.15
+  [../]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+  [./vapor_ic]
+    variable = u
+    type = PikaChemicalPotentialIC
+    block = 0
+    phase_variable = phi
+    temperature = T
+  [../]
+  [./u_initial_ic]
+    variable = u_initial
+    type = PikaChemicalPotentialIC
+    phase_variable = phi
+    temperature = T
+  [../]
+[]
+
+[Kernels]
+  [./heat_diffusion]
+    type = PikaDiffusion
+    variable = T
+    use_temporal_scaling = true
+    property = conductivity
+  [../]
+  [./heat_time]
+    type = PikaTimeDerivative
+    variable = T
+    property = heat_capacity
+  [../]
+  [./vapor_time]
+    type = PikaTimeDerivative
+    variable = u
+    coefficient = 1.0
+    block = 0
+  [../]
+  [./vapor_diffusion]
+    type = PikaDiffusion
+    variable = u
+    use_temporal_scaling = true
+    property = diffusion_coefficient
+    block = 0
+  [../]
+  [./vapor_phi_time]
+    type = PikaCoupledTimeDerivative
+    variable = u
+    coefficient = 0.5
+    coupled_variable = phi
+    use_temporal_scaling = true
+    block = 0
+  [../]
+  [./phi_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phi_transition]
+    # The coupling vanishes in the ice interior
+    type = PhaseTransition
+    variable = phi
+    mob_name = mobility
+    chemical_potential = u
+    lambda = phase_field_coupling_constant
+    block = 0
+  [../]
+  [./phi_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+  [./phi_square_gradient]
+    type = ACInterface
+    variable = phi
+    mob_name = mobility
+    kappa_name = interface_thickness_squared
+  [../]
+[]
+
+[PikaMaterials]
+  block = '0 1'
+  temperature = T
+  interface_thickness = 2e-5
+  temporal_scaling = 1e-4
+  condensation_coefficient = .01
+  phase = phi
+[]
+
+[UserObjects]
+  [./pore]
+    type = PikaPoreSubdomain
+    phase = phi
+    pore_subdomain = 0
+    ice_subdomain = 1
+    chemical_potential = u
+    temperature = T
+  [../]
+[]
+
+[BCs]
+  [./undersaturated]
+    # The pore vapor is below saturation, so the ice sublimates and the pore space grows
+    type = DirichletBC
+    variable = u
+    boundary = 'left right top bottom'
+    value = -1e-7
+  [../]
+[]
+
+[Postprocessors]
+  [./dofs]
+    type = NumDOFs
+    system = NL
+    execute_on = 'initial timestep_end'
+  [../]
+  [./u_error]
+    # Vanishes if the vapor added by the initial move matches the initial condition
+    type = ElementL2Difference
+    variable = u
+    other_variable = u_initial
+    block = 0
+    execute_on = initial
+  [../]
+  [./phi_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = phi
+  [../]
+  [./T_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = T
+  [../]
+[]
+
+[Executioner]
+  type = PikaTransient
+  pore_subdomain = pore
+  num_steps = 3
+  dt = 800
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+  [./initial]
+    type = CSV
+    file_base = pore_subdomain_initial
+    execute_on = initial
+    show = 'dofs u_error'
+  [../]
+  [./steps]
+    # The degrees of freedom of each step are reported before the move that follows it
+    type = CSV
+    file_base = pore_subdomain_steps
+    execute_on = timestep_end
+    show = 'dofs phi_integral T_integral'
+  [../]
+[]
@@ -0,0 +1,39 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Independent calculation of gold/pore_subdomain_initial.csv: the elements of pore_subdomain.i
+# with all nodal phase values above the threshold are ice, the nonlinear degrees of freedom are
+# T and phi at every node and u at the nodes of the pore elements. The vapor added by the initial
+# move equals the initial condition, so the L2 difference vanishes.
+# Run from this directory: python pore_subdomain_gold.py > gold/pore_subdomain_initial.csv
+from __future__ import print_function
+import math
+
+# pore_subdomain.i
+n, length = 32, 0.001
+threshold = 0.99
+h = length / n
+
+def phase(x, y):
+  return math.tanh((0.0003 - math.sqrt((x - 0.0005)**2 + (y - 0.0005)**2)) / (math.sqrt(2) * 2e-5))
+
+nodes = set()
+for i in range(n):
+  for j in range(n):
+    element = [(a, b) for a in (i, i + 1) for b in (j, j + 1)]
+    if not all(phase(a * h, b * h) > threshold for a, b in element):
+      nodes.update(element)
+
+print('time,dofs,u_error')
+print('0,%d,0' % (2 * (n + 1)**2 + len(nodes)))
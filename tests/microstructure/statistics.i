@@ -0,0 +1,117 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 32
+  ny = 32
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[Variables]
+  [./phi]
+  [../]
+[]
+
+[AuxVariables]
+  [./velocity]
+    initial_condition = 1e-8
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.00025-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*5e-5))'
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+[]
+
+[Kernels]
+  [./phase_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phase_diffusion]
+    type = PikaDiffusion
+    variable = phi
+    property = interface_thickness_squared
+  [../]
+  [./phase_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = 263.15
+  interface_thickness = 5e-5
+  phase = phi
+  temporal_scaling = 1e-04
+  condensation_coefficient = .01
+[]
+
+[VectorPostprocessors]
+  # For the circle of radius 2.5e-4 the sharp interface values are an ice fraction of 0.196, a
+  # specific surface area of 8000 1/m and a mean curvature of 4000 1/m; the diffuse interface
+  # (W = 5e-5) adds ice outside of the radius, see the gold values in the tests file
+  [./microstructure]
+    type = PikaMicrostructureStatistics
+    phase = phi
+    interface_velocity = velocity
+    velocity_min = -1e-7
+    velocity_max = 1e-7
+    num_bins = 10
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Postprocessors]
+  [./ice_fraction]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = microstructure
+    vector_name = ice_volume_fraction
+    index = 0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./interface_area]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = microstructure
+    vector_name = interface_area
+    index = 0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./specific_surface_area]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = microstructure
+    vector_name = specific_surface_area
+    index = 0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./mean_curvature]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = microstructure
+    vector_name = mean_curvature
+    index = 0
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,85 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 32
+  ny = 32
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[Variables]
+  [./phi]
+  [../]
+[]
+
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.00025-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*5e-5))'
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+[]
+
+[Kernels]
+  [./phase_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phase_diffusion]
+    type = PikaDiffusion
+    variable = phi
+    property = interface_thickness_squared
+  [../]
+  [./phase_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = 263.15
+  interface_thickness = 5e-5
+  phase = phi
+  temporal_scaling = 1e-04
+  condensation_coefficient = .01
+[]
+
+[VectorPostprocessors]
+  # The reference for the rebuilt fields (see compare_band.py)
+  [./nodes]
+    type = NodalValueSampler
+    variable = phi
+    sort_by = id
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  [./band]
+    type = PikaBandOutput
+    phase = phi
+    full_interval = 2
+    file_base = band
+  [../]
+  [./csv]
+    type = CSV
+    file_base = band_csv
+  [../]
+[]
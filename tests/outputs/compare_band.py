@@ -0,0 +1,67 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Rebuilds each PikaBandOutput output of band.i and compares the phase with the nodal values
+# written by the NodalValueSampler of the same run (<sampler_base>_<output>.csv); the bulk values
+# are taken from the latest checkpoint, so a small relative difference is allowed. With
+# --compressed and --bytes the format of the files written with 'compress' and 'precision' is
+# checked; single precision values require a tolerance above the float32 resolution (1.2e-7).
+from __future__ import print_function
+import os, sys, csv, glob, gzip, struct, argparse
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'python', 'tools'))
+from rebuildBandOutput import outputNumbers, rebuild
+
+def checkFormat(file_base, compressed, bytes_per_value):
+  files = glob.glob('{}_full_*.bin*'.format(file_base)) + glob.glob('{}_band_*.bin*'.format(file_base))
+  for filename in files:
+    if filename.endswith('.gz') != compressed:
+      return '{} is {}compressed'.format(filename, '' if filename.endswith('.gz') else 'not ')
+    with (gzip.open if compressed else open)(filename, 'rb') as f:
+      header = f.read(14)
+    if struct.unpack('=B', header[13:14])[0] != bytes_per_value:
+      return '{} does not contain {} byte values'.format(filename, bytes_per_value)
+  return None
+
+def compare(file_base, sampler_base, tol=1e-6):
+  numbers = sorted(set(outputNumbers(file_base, 'full') + outputNumbers(file_base, 'band')), key=int)
+  if not numbers:
+    return 'No PikaBandOutput files found for {}'.format(file_base)
+
+  for number in numbers:
+    result = rebuild(file_base, number)
+    phase = result['names'][0]
+    with open('{}_{:04d}.csv'.format(sampler_base, int(number))) as f:
+      expected = dict((int(float(row['id'])), float(row[phase])) for row in csv.DictReader(f))
+
+    if set(result['values'][phase].keys()) != set(expected.keys()):
+      return 'Output {}: the rebuilt nodes do not match the mesh'.format(number)
+    for node, value in expected.items():
+      if abs(result['values'][phase][node] - value) > tol * max(1.0, abs(value)):
+        return 'Output {}: node {} rebuilt as {}, expected {}'.format(number, node, result['values'][phase][node], value)
+    print('Output {}: {} nodes match'.format(number, len(expected)))
+  return None
+
+if __name__ == '__main__':
+  parser = argparse.ArgumentParser(description='Compares the rebuilt PikaBandOutput fields with the sampled nodal values')
+  parser.add_argument('file_base', help='The file_base of the PikaBandOutput object')
+  parser.add_argument('sampler_base', help='The file_base of the NodalValueSampler CSV files')
+  parser.add_argument('--tol', type=float, default=1e-6, help='The allowed difference relative to max(1, |value|)')
+  parser.add_argument('--compressed', action='store_true', help='The files must be compressed')
+  parser.add_argument('--bytes', type=int, default=8, choices=[4, 8], help='The bytes per value of the files')
+  args = parser.parse_args()
+
+  error = checkFormat(args.file_base, args.compressed, args.bytes) or compare(args.file_base, args.sampler_base, args.tol)
+  if error:
+    sys.exit(error)
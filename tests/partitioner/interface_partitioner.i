@@ -0,0 +1,106 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmax = 0.001
+  ymax = 0.001
+  [./Partitioner]
+    type = PikaInterfacePartitioner
+    phase = phi
+    interface_weight = 10
+  [../]
+[]
+
+[Variables]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.0003-sqrt(x^2+y^2))/(sqrt(2)*5e-5))'
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+[]
+
+[Kernels]
+  [./phase_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phase_diffusion]
+    type = PikaDiffusion
+    variable = phi
+    property = interface_thickness_squared
+  [../]
+  [./phase_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = 263.15
+  interface_thickness = 5e-5
+  phase = phi
+  temporal_scaling = 1e-04
+[]
+
+[Postprocessors]
+  [./imbalance]
+    type = PikaLoadImbalance
+    phase = phi
+    interface_weight = 10
+    execute_on = 'initial timestep_end'
+  [../]
+  [./balanced]
+    # One while the imbalance is below the re-partition threshold
+    type = ParsedPostprocessor
+    function = 'if(imbalance < 1.1, 1, 0)'
+    pp_names = imbalance
+    execute_on = 'initial timestep_end'
+  [../]
+  [./phi_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = phi
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[UserObjects]
+  [./repartition]
+    type = PikaRepartition
+    imbalance = imbalance
+    threshold = 1.1
+  [../]
+[]
+
+[Executioner]
+  type = PikaTransient
+  repartition = repartition
+  num_steps = 2
+  dt = 1
+  solve_type = PJFNK
+  nl_rel_tol = 1e-07
+  nl_abs_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+  [./balanced]
+    type = CSV
+    file_base = interface_partitioner_balanced
+    show = balanced
+  [../]
+[]
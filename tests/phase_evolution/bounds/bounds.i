@@ -0,0 +1,124 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 16
+  ny = 16
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[Variables]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    # A sharp interface; with the consistent mass, the unconstrained solution overshoots the
+    # bounds next to it by about 1.5% in the first step
+    value = 'if(sqrt((x-0.0005)^2+(y-0.0005)^2)<0.00027,1,-1)'
+  [../]
+  [./one]
+    type = ParsedFunction
+    value = 1
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+[]
+
+[Kernels]
+  [./phase_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phase_diffusion]
+    type = PikaDiffusion
+    variable = phi
+    property = interface_thickness_squared
+  [../]
+  [./phase_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = 263.15
+  interface_thickness = 5e-5
+  phase = phi
+  temporal_scaling = 1e-04
+  condensation_coefficient = .01
+[]
+
+[PikaPhaseBounds]
+  phase = phi
+[]
+
+[Postprocessors]
+  [./phi_min]
+    type = NodalExtremeValue
+    variable = phi
+    value_type = min
+    execute_on = 'initial timestep_end'
+  [../]
+  [./phi_max]
+    type = NodalExtremeValue
+    variable = phi
+    value_type = max
+    execute_on = 'initial timestep_end'
+  [../]
+  [./bounded]
+    # One while the phase-field remains within [-1, 1]
+    type = ParsedPostprocessor
+    function = 'if(phi_max <= 1 & phi_min >= -1, 1, 0)'
+    pp_names = 'phi_max phi_min'
+    execute_on = 'initial timestep_end'
+  [../]
+  [./one]
+    type = FunctionValuePostprocessor
+    function = one
+    execute_on = 'initial timestep_end'
+    outputs = none
+  [../]
+  [./steps]
+    # The number of timesteps taken
+    type = CumulativeValuePostprocessor
+    postprocessor = one
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  # Steps of about 0.013 relaxation times, the phase remains within [-1, 1] without cutting the
+  # timestep
+  type = Transient
+  end_time = 5e4
+  dt = 1e4
+  solve_type = NEWTON
+  petsc_options_iname = '-snes_type'
+  petsc_options_value = 'vinewtonrsls'
+[]
+
+[Outputs]
+  csv = true
+  [./bounded]
+    type = CSV
+    file_base = bounds_bounded
+    show = 'bounded steps'
+  [../]
+[]
@@ -0,0 +1,101 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 16
+  ny = 16
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[Variables]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.00025-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*5e-5))'
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+[]
+
+[Kernels]
+  [./phase_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+    lumping = true
+  [../]
+  [./phase_diffusion]
+    type = PikaDiffusion
+    variable = phi
+    property = interface_thickness_squared
+  [../]
+  [./phase_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = 263.15
+  interface_thickness = 5e-5
+  phase = phi
+  temporal_scaling = 1e-04
+  condensation_coefficient = .01
+[]
+
+[Postprocessors]
+  [./stable_dt]
+    type = PikaPhaseStableTimeStep
+    execute_on = 'initial timestep_end'
+  [../]
+  [./phi_max]
+    type = NodalMaxValue
+    variable = phi
+    execute_on = 'initial timestep_end'
+  [../]
+  [./phi_min]
+    type = NodalMinValue
+    variable = phi
+    execute_on = 'initial timestep_end'
+  [../]
+  [./bounded]
+    # One while the phase-field remains within [-1, 1]
+    type = ParsedPostprocessor
+    function = 'if(phi_max <= 1 & phi_min >= -1, 1, 0)'
+    pp_names = 'phi_max phi_min'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  [./TimeIntegrator]
+    type = ActuallyExplicitEuler
+    solve_type = lumped
+  [../]
+  [./TimeStepper]
+    type = PostprocessorDT
+    postprocessor = stable_dt
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  [./stable]
+    type = CSV
+    file_base = explicit_stable
+    show = 'stable_dt bounded'
+  [../]
+[]
@@ -0,0 +1,46 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Compares the postprocessor CSV files of predictor_coupled.i run without (reference) and with
+# the phase predictor: the predictor must reduce the total number of nonlinear iterations and
+# leave the converged solution unchanged.
+from __future__ import print_function
+import sys, csv
+
+def read(filename):
+  with open(filename) as f:
+    return [dict((key, float(value)) for key, value in row.items()) for row in csv.DictReader(f)]
+
+def compare(reference_file, predicted_file, tol=1e-6):
+  reference = read(reference_file)
+  predicted = read(predicted_file)
+  if len(reference) != len(predicted):
+    return 'The number of timesteps differs'
+
+  for ref, pred in zip(reference, predicted):
+    for name in ['ice_fraction', 'u_average']:
+      if abs(ref[name] - pred[name]) > tol * max(abs(ref[name]), 1e-12):
+        return 'The {} at time {} changed from {} to {}'.format(name, ref['time'], ref[name], pred[name])
+
+  ref_its = sum(row['nonlinear_its'] for row in reference)
+  pred_its = sum(row['nonlinear_its'] for row in predicted)
+  print('Nonlinear iterations: {:g} without and {:g} with the predictor'.format(ref_its, pred_its))
+  if pred_its >= ref_its:
+    return 'The predictor did not reduce the number of nonlinear iterations'
+  return None
+
+if __name__ == '__main__':
+  error = compare(sys.argv[1], sys.argv[2])
+  if error:
+    sys.exit(error)
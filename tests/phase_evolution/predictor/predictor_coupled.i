@@ -0,0 +1,145 @@
+# Isothermal vapor/phase problem with the interface velocity computed by PikaInterfaceVelocity on
+# a constant monomial variable, see compare_predictor.py
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  xmax = 0.005
+  ymax = 0.005
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.0015-sqrt((x-0.0025)^2+(y-0.0025)^2))/(sqrt(2)*1e-4))'
+  [../]
+[]
+
+[AuxVariables]
+  [./T]
+    initial_condition = 264.8
+  [../]
+  [./velocity]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[AuxKernels]
+  [./velocity_aux]
+    type = PikaInterfaceVelocity
+    variable = velocity
+    phase = phi
+    chemical_potential = u
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Kernels]
+  [./vapor_time]
+    type = PikaTimeDerivative
+    variable = u
+    coefficient = 1.0
+  [../]
+  [./vapor_diffusion]
+    type = PikaDiffusion
+    variable = u
+    use_temporal_scaling = true
+    property = diffusion_coefficient
+  [../]
+  [./vapor_phi_time]
+    type = PikaCoupledTimeDerivative
+    variable = u
+    coefficient = 0.5
+    coupled_variable = phi
+    use_temporal_scaling = true
+  [../]
+  [./phi_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phi_transition]
+    type = PhaseTransition
+    variable = phi
+    mob_name = mobility
+    chemical_potential = u
+    coefficient = 1.0
+    lambda = phase_field_coupling_constant
+  [../]
+  [./phi_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+  [./phi_square_gradient]
+    type = ACInterface
+    variable = phi
+    mob_name = mobility
+    kappa_name = interface_thickness_squared
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+  [./vapor_ic]
+    variable = u
+    type = PikaChemicalPotentialIC
+    phase_variable = phi
+    temperature = T
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = T
+  interface_thickness = 1e-4
+  temporal_scaling = 1e-4
+  condensation_coefficient = .01
+  phase = phi
+[]
+
+[Postprocessors]
+  [./nonlinear_its]
+    type = NumNonlinearIterations
+  [../]
+  [./ice_fraction]
+    type = ElementAverageValue
+    variable = phi
+  [../]
+  [./u_average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1
+  solve_type = PJFNK
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-14
+  [./Predictor]
+    type = PikaPhasePredictor
+    phase = phi
+    method = advection
+    interface_velocity = velocity
+    scale = 1
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
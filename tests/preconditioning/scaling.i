@@ -0,0 +1,176 @@
+# The coupled problem of pika_fsp.i solved with and without the automatic scaling, see the
+# 'automatic_scaling' tests
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  xmax = 0.005
+  ymax = 0.005
+[]
+
+[Variables]
+  [./T]
+  [../]
+  [./u]
+  [../]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.0015-sqrt((x-0.0025)^2+(y-0.0025)^2))/(sqrt(2)*1e-4))'
+  [../]
+[]
+
+[Kernels]
+  [./heat_diffusion]
+    type = PikaDiffusion
+    variable = T
+    use_temporal_scaling = true
+    property = conductivity
+  [../]
+  [./heat_time]
+    type = PikaTimeDerivative
+    variable = T
+    property = heat_capacity
+  [../]
+  [./heat_phi_time]
+    type = PikaCoupledTimeDerivative
+    variable = T
+    property = latent_heat
+    scale = -0.5
+    use_temporal_scaling = true
+    coupled_variable = phi
+  [../]
+  [./vapor_time]
+    type = PikaTimeDerivative
+    variable = u
+    coefficient = 1.0
+  [../]
+  [./vapor_diffusion]
+    type = PikaDiffusion
+    variable = u
+    use_temporal_scaling = true
+    property = diffusion_coefficient
+  [../]
+  [./vapor_phi_time]
+    type = PikaCoupledTimeDerivative
+    variable = u
+    coefficient = 0.5
+    coupled_variable = phi
+    use_temporal_scaling = true
+  [../]
+  [./phi_time]
+    type = PikaTimeDerivative
+    variable = phi
+    property = relaxation_time
+  [../]
+  [./phi_transition]
+    type = PhaseTransition
+    variable = phi
+    mob_name = mobility
+    chemical_potential = u
+    coefficient = 1.0
+    lambda = phase_field_coupling_constant
+  [../]
+  [./phi_double_well]
+    type = DoubleWellPotential
+    variable = phi
+    mob_name = mobility
+  [../]
+  [./phi_square_gradient]
+    type = ACInterface
+    variable = phi
+    mob_name = mobility
+    kappa_name = interface_thickness_squared
+  [../]
+[]
+
+[BCs]
+  [./T_hot]
+    type = DirichletBC
+    variable = T
+    boundary = bottom
+    value = 267.515
+  [../]
+  [./T_cold]
+    type = DirichletBC
+    variable = T
+    boundary = top
+    value = 264.8
+  [../]
+[]
+
+[ICs]
+  [./phase_ic]
+    variable = phi
+    type = FunctionIC
+    function = phi_func
+  [../]
+  [./temperature_ic]
+    variable = T
+    type = ConstantIC
+    value = 264.8
+  [../]
+  [./vapor_ic]
+    variable = u
+    type = PikaChemicalPotentialIC
+    phase_variable = phi
+    temperature = T
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = T
+  interface_thickness = 1e-4
+  temporal_scaling = 1e-4
+  condensation_coefficient = .01
+  phase = phi
+[]
+
+[Postprocessors]
+  [./T_average]
+    type = ElementAverageValue
+    variable = T
+  [../]
+  [./u_average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./phi_average]
+    type = ElementAverageValue
+    variable = phi
+  [../]
+  [./linear_its]
+    type = NumLinearIterations
+  [../]
+[]
+
+[Preconditioning]
+  # Algebraic multigrid on the coupled system, which is sensitive to the relative scale of the
+  # equations, unlike the field-split preconditioner
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-30
+  nl_max_its = 30
+  l_max_its = 200
+[]
+
+[Outputs]
+  csv = true
+[]
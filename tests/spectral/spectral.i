@@ -0,0 +1,91 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+  xmax = 0.001
+  ymax = 0.001
+[]
+
+[AuxVariables]
+  [./T]
+  [../]
+  [./u]
+  [../]
+  [./phi]
+  [../]
+[]
+
+[Functions]
+  [./phi_func]
+    type = ParsedFunction
+    value = 'tanh((0.00025-sqrt((x-0.0005)^2+(y-0.0005)^2))/(sqrt(2)*5e-5))'
+  [../]
+[]
+
+[UserObjects]
+  [./spectral]
+    type = PikaSpectralSolver
+    resolution = '32 32'
+    phase_function = phi_func
+    temperature_function = 263.15
+  [../]
+[]
+
+[AuxKernels]
+  [./T_aux]
+    type = PikaSpectralAux
+    variable = T
+    spectral_solver = spectral
+    field = temperature
+    execute_on = 'initial timestep_end'
+  [../]
+  [./u_aux]
+    type = PikaSpectralAux
+    variable = u
+    spectral_solver = spectral
+    field = chemical_potential
+    execute_on = 'initial timestep_end'
+  [../]
+  [./phi_aux]
+    type = PikaSpectralAux
+    variable = phi
+    spectral_solver = spectral
+    field = phase
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[PikaMaterials]
+  temperature = T
+  phase = phi
+  interface_thickness = 5e-5
+  temporal_scaling = 1e-4
+[]
+
+[Postprocessors]
+  [./ice_fraction]
+    type = ElementAverageValue
+    variable = phi
+  [../]
+  [./u_max]
+    type = ElementExtremeValue
+    variable = u
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,49 @@
+#!/usr/bin/env python
+##################################################################################
+#                  Pika: Phase field snow micro-structure model                  #
+#                                                                                #
+#                     (C) 2014 Battelle Energy Alliance, LLC                     #
+#                              ALL RIGHTS RESERVED                               #
+#                                                                                #
+#                   Prepared by Battelle Energy Alliance, LLC                    #
+#                      Under Contract No. DE-AC07-05ID14517                      #
+#                      With the U. S. Department of Energy                       #
+##################################################################################
+
+
+##
+# Checks the per-step CSV file written by PikaTimerReport for timers.i: one row for each
+# timestep, a column for each instrumented section, and non-negative times with time spent in
+# the residual of each step.
+# Usage: python check_timers.py <file> <number of timesteps>
+from __future__ import print_function
+import sys, csv
+
+SECTIONS = ['diff/computeResidual', 'diff/computeJacobian', 'time/computeResidual',
+            'time/computeJacobian', '_pika_material/computeProperties']
+
+def check(filename, num_steps):
+  try:
+    with open(filename) as f:
+      rows = list(csv.DictReader(f))
+  except IOError as e:
+    return str(e)
+
+  if len(rows) != num_steps:
+    return '{} has {} rows, expected {}'.format(filename, len(rows), num_steps)
+  missing = [name for name in SECTIONS if name not in rows[0]]
+  if missing:
+    return 'Missing columns: {}'.format(', '.join(missing))
+
+  for row in rows:
+    if any(float(value) < 0 for value in row.values()):
+      return 'Negative time at time {}'.format(row['time'])
+    if float(row['diff/computeResidual']) <= 0:
+      return 'No residual time recorded at time {}'.format(row['time'])
+  print('{}: {} steps and {} sections'.format(filename, len(rows), len(rows[0]) - 1))
+  return None
+
+if __name__ == '__main__':
+  error = check(sys.argv[1], int(sys.argv[2]))
+  if error:
+    sys.exit(error)
@@ -0,0 +1,61 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = PikaDiffusion
+    variable = u
+    property = diffusion_coefficient
+  [../]
+  [./time]
+    type = PikaTimeDerivative
+    variable = u
+    coefficient = 1
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[PikaMaterials]
+  water_vapor_diffusion_coefficient = 0.1
+  temperature = u
+  phase = -1
+[]
+
+[UserObjects]
+  [./timers]
+    type = PikaTimerReport
+    per_step_csv = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]